@@ -0,0 +1,52 @@
+// Lookup cost in s21::set with contains() in a loop against contains_batch(),
+// for sets from cache-resident to many times the size of the cache. Half of
+// the probed keys are present.
+//
+//   make bench
+//   ./benchmarks/s21_batch_find_bench [probes]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double nanosPerKey(Clock::time_point start, size_t keys) {
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  return elapsed.count() / keys;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  int probes = argc > 1 ? std::atoi(argv[1]) : 2000000;
+
+  std::printf("%d probes, ns per key\n", probes);
+  std::printf("%10s %12s %12s\n", "set size", "loop", "batch");
+  for (int size = 1000; size <= 4000000; size *= 4) {
+    std::mt19937 rng(size);
+    std::vector<int> keys(size);
+    s21::set<int> set;
+    for (int &key : keys) set.insert(key = rng());
+
+    std::vector<int> probe(probes);
+    for (int &key : probe) key = rng() % 2 ? keys[rng() % size] : rng();
+    std::vector<char> loop(probes), batch(probes);
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < probes; ++i) loop[i] = set.contains(probe[i]);
+    double loopTime = nanosPerKey(start, probes);
+
+    start = Clock::now();
+    set.contains_batch(probe.begin(), probe.end(), batch.begin());
+    double batchTime = nanosPerKey(start, probes);
+
+    if (loop != batch) std::printf("results differ\n");
+    std::printf("%10d %12.1f %12.1f\n", size, loopTime, batchTime);
+  }
+  return 0;
+}
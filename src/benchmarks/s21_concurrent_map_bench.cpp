@@ -0,0 +1,116 @@
+// Throughput of s21::concurrent_map against s21::map behind one std::mutex,
+// at 1 to 64 threads. Each thread runs a mixed workload over a shared key
+// range: mostly lookups, some inserts and erases, and short range scans.
+//
+//   make bench
+//   ./benchmarks/s21_concurrent_map_bench [ops per thread]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+const int kKeyRange = 1 << 16;
+const int kScanLength = 16;
+
+class LockedMap {
+ public:
+  bool contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert(key, value);
+  }
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) map_.erase(it);
+  }
+  long scan(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    long sum = 0;
+    int count = 0;
+    for (auto it = map_.lower_bound(key);
+         it != map_.end() && count < kScanLength; ++it, ++count)
+      sum += *it;
+    return sum;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<int, int> map_;
+};
+
+class LockFreeMap {
+ public:
+  bool contains(int key) { return map_.contains(key); }
+  void insert(int key, int value) { map_.insert(key, value); }
+  void erase(int key) { map_.erase(key); }
+  long scan(int key) {
+    long sum = 0;
+    int count = 0;
+    for (auto it = map_.lower_bound(key);
+         it != map_.end() && count < kScanLength; ++it, ++count)
+      sum += *it;
+    return sum;
+  }
+
+ private:
+  s21::concurrent_map<int, int> map_;
+};
+
+// 80% lookups, 9% inserts, 9% erases, 2% scans.
+template <typename Map>
+double run(int threads, int opsPerThread) {
+  Map map;
+  for (int key = 0; key < kKeyRange; key += 2) map.insert(key, key);
+
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&map, t, opsPerThread]() {
+      std::mt19937 rng(t + 1);
+      long sink = 0;
+      for (int i = 0; i < opsPerThread; ++i) {
+        int key = rng() % kKeyRange;
+        int op = rng() % 100;
+        if (op < 80)
+          sink += map.contains(key);
+        else if (op < 89)
+          map.insert(key, key);
+        else if (op < 98)
+          map.erase(key);
+        else
+          sink += map.scan(key);
+      }
+      if (sink == -1) std::printf("%ld\n", sink);
+    });
+  for (std::thread &worker : workers) worker.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return threads * static_cast<double>(opsPerThread) / elapsed.count();
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  int opsPerThread = argc > 1 ? std::atoi(argv[1]) : 200000;
+
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("%8s %18s %18s\n", "threads", "mutex+map Mops/s",
+              "concurrent Mops/s");
+  for (int threads = 1; threads <= 64; threads *= 2) {
+    double locked = run<LockedMap>(threads, opsPerThread);
+    double lockFree = run<LockFreeMap>(threads, opsPerThread);
+    std::printf("%8d %18.2f %18.2f\n", threads, locked / 1e6, lockFree / 1e6);
+  }
+  return 0;
+}
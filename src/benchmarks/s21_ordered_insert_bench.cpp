@@ -0,0 +1,88 @@
+// Insertion cost into s21::map and s21::multiset for keys arriving in
+// increasing order, as with time-ordered events, against the same keys in
+// random order. Sorted keys go in with plain insert() and with end() as the
+// hint; std::map and std::multiset are shown for reference.
+//
+//   make bench
+//   ./benchmarks/s21_ordered_insert_bench [count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+enum Mode { kPlain, kHinted };
+
+template <typename Container>
+void add(Container &container, int key, Mode mode) {
+  if (mode == kHinted)
+    container.insert(container.end(), {key, key});
+  else
+    container.insert({key, key});
+}
+
+template <typename Key, typename Allocator>
+void add(s21::multiset<Key, Allocator> &container, int key, Mode mode) {
+  if (mode == kHinted)
+    container.insert(container.end(), key);
+  else
+    container.insert(key);
+}
+
+template <typename Key>
+void add(std::multiset<Key> &container, int key, Mode mode) {
+  if (mode == kHinted)
+    container.insert(container.end(), key);
+  else
+    container.insert(key);
+}
+
+// Nanoseconds per insert, best of three runs.
+template <typename Container>
+double run(const std::vector<int> &keys, Mode mode) {
+  double best = 0;
+  for (int round = 0; round < 3; ++round) {
+    Container container;
+    auto start = std::chrono::steady_clock::now();
+    for (int key : keys) add(container, key, mode);
+    std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    double perInsert = elapsed.count() / keys.size();
+    if (round == 0 || perInsert < best) best = perInsert;
+  }
+  return best;
+}
+
+template <typename Container>
+void report(const char *name, const std::vector<int> &sorted,
+            const std::vector<int> &shuffled) {
+  std::printf("%-16s %12.1f %12.1f %12.1f\n", name,
+              run<Container>(shuffled, kPlain), run<Container>(sorted, kPlain),
+              run<Container>(sorted, kHinted));
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::vector<int> sorted(count);
+  for (int i = 0; i < count; ++i) sorted[i] = i;
+  std::vector<int> shuffled(sorted);
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(1));
+
+  std::printf("%d keys, ns per insert\n", count);
+  std::printf("%-16s %12s %12s %12s\n", "container", "random", "sorted",
+              "sorted+hint");
+  report<s21::map<int, int>>("s21::map", sorted, shuffled);
+  report<std::map<int, int>>("std::map", sorted, shuffled);
+  report<s21::multiset<int>>("s21::multiset", sorted, shuffled);
+  report<std::multiset<int>>("std::multiset", sorted, shuffled);
+  return 0;
+}
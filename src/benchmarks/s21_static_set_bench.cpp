@@ -0,0 +1,75 @@
+// Lookup cost in s21::set against the same keys frozen into a static_set in
+// Eytzinger and van Emde Boas layout, and a plain binary search over the
+// sorted keys, for sets from cache-resident to many times the size of the
+// cache. Half of the probed keys are present.
+//
+//   make bench
+//   ./benchmarks/s21_static_set_bench [probes]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double nanosPerKey(Clock::time_point start, size_t keys) {
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  return elapsed.count() / keys;
+}
+
+template <typename Contains>
+double timeLookups(const std::vector<int> &probe, std::vector<char> &found,
+                   Contains contains) {
+  Clock::time_point start = Clock::now();
+  for (size_t i = 0; i < probe.size(); ++i) found[i] = contains(probe[i]);
+  return nanosPerKey(start, probe.size());
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  int probes = argc > 1 ? std::atoi(argv[1]) : 2000000;
+
+  std::printf("%d probes, ns per key\n", probes);
+  std::printf("%10s %10s %10s %10s %10s\n", "set size", "set", "eytzinger",
+              "veb", "sorted");
+  for (int size = 1000; size <= 4000000; size *= 4) {
+    std::mt19937 rng(size);
+    std::vector<int> keys(size);
+    s21::set<int> set;
+    for (int &key : keys) set.insert(key = rng());
+    s21::static_set<int> eytzinger(set);
+    s21::static_set<int, s21::VanEmdeBoasLayout> veb(set);
+    std::vector<int> sorted;
+    for (int key : set) sorted.push_back(key);
+
+    std::vector<int> probe(probes);
+    for (int &key : probe) key = rng() % 2 ? keys[rng() % size] : rng();
+    std::vector<char> expected(probes), found(probes);
+
+    double setTime = timeLookups(
+        probe, expected, [&set](int key) { return set.contains(key); });
+    double eytzingerTime = timeLookups(probe, found, [&eytzinger](int key) {
+      return eytzinger.contains(key);
+    });
+    bool same = found == expected;
+    double vebTime = timeLookups(probe, found,
+                                 [&veb](int key) { return veb.contains(key); });
+    same = same && found == expected;
+    double sortedTime = timeLookups(probe, found, [&sorted](int key) {
+      return std::binary_search(sorted.begin(), sorted.end(), key);
+    });
+    same = same && found == expected;
+
+    if (!same) std::printf("results differ\n");
+    std::printf("%10d %10.1f %10.1f %10.1f %10.1f\n", size, setTime,
+                eytzingerTime, vebTime, sortedTime);
+  }
+  return 0;
+}
@@ -1,40 +1,98 @@
 #ifndef __S21_CONTAINERS_RBTREE_H__
 #define __S21_CONTAINERS_RBTREE_H__
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "s21_node_pool.h"
 #include "s21_vector.h"
 
 namespace s21 {
+// Payload of an RBTree node. Sets pass void for Value and get nodes that
+// hold the key alone, which then doubles as the value.
 template <typename Key, typename Value>
+struct RBTreeNodeSlot {
+  Key key;
+  Value mapped;
+
+  RBTreeNodeSlot() : key(), mapped() {}
+  template <typename K, typename... Args>
+  RBTreeNodeSlot(std::in_place_t, K &&key, Args &&...args)
+      : key(std::forward<K>(key)), mapped(std::forward<Args>(args)...) {}
+
+  Value &value() { return mapped; }
+};
+
+template <typename Key>
+struct RBTreeNodeSlot<Key, void> {
+  Key key;
+
+  RBTreeNodeSlot() : key() {}
+  template <typename K>
+  RBTreeNodeSlot(std::in_place_t, K &&key) : key(std::forward<K>(key)) {}
+
+  Key &value() { return key; }
+};
+
+template <typename Key, typename Value,
+          typename Allocator = PoolAllocator<Value>>
 class RBTree {
  public:
+  struct NodeBase;
   struct Node;
 
   class Iterator;
   class ConstIterator;
+  class NodeHandle;
+  struct InsertReturn;
 
   using key_type = Key;
-  using value_type = Value;
+  using value_type = std::conditional_t<std::is_void<Value>::value, Key, Value>;
   using reference = value_type &;
   using const_reference = const value_type &;
   using iterator = Iterator;
   using const_iterator = ConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
+  using node_type = NodeHandle;
+  using insert_return_type = InsertReturn;
 
   enum NodeColor { BLACK, RED };
 
-  struct Node {
-    key_type key;
-    value_type value;
-    Node *left, *parent, *right;
-    enum NodeColor color;
-    Node();
-    Node(NodeColor color);
+  using slot_type = RBTreeNodeSlot<Key, Value>;
+
+  // Links of a node without its payload, which is all the header needs. The
+  // colour takes the low bit of the parent pointer, which the node's
+  // alignment leaves clear. The 32-bit subtree size goes last so that a
+  // small key can fill the padding after it.
+  struct NodeBase {
+    Node *left, *right;
+    uintptr_t parentAndColor;
+    uint32_t size;
+
+    explicit NodeBase(NodeColor color);
+
+    Node *parent() const;
+    void setParent(Node *parent);
+    NodeColor color() const;
+    void setColor(NodeColor color);
+  };
+
+  struct Node : NodeBase, slot_type {
+    explicit Node(const slot_type &slot);
+    explicit Node(slot_type &&slot);
+    template <typename K, typename... Args>
+    Node(std::in_place_t, K &&key, Args &&...args);
   };
 
   RBTree();
+  explicit RBTree(const Allocator &alloc);
   RBTree(std::initializer_list<value_type> const &items);
   RBTree(const RBTree &other);
   RBTree(RBTree &&other);
@@ -48,21 +106,45 @@ class RBTree {
   size_type max_size();
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
+  insert_return_type insert(node_type &&nh);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const key_type &key);
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+  node_type extract(iterator pos);
+  node_type extract(const key_type &key);
   void swap(RBTree &other);
   void merge(RBTree &other);
+  void split(const key_type &key, RBTree &right);
+  void join(RBTree &right);
+  void set_union(const RBTree &other);
+  void set_intersection(const RBTree &other);
+  void set_difference(const RBTree &other);
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
   iterator find(const key_type &key);
   bool contains(const key_type &key);
+  template <typename InputIt, typename OutputIt>
+  OutputIt find_batch(InputIt first, InputIt last, OutputIt out);
+  template <typename InputIt, typename OutputIt>
+  OutputIt contains_batch(InputIt first, InputIt last, OutputIt out);
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  iterator nth(size_type k);
+  size_type rank(const key_type &key);
+  allocator_type get_allocator();
   void visualize(Node *root = nullptr);
 
   class Iterator {
    public:
-    friend RBTree<Key, Value>;
-    Node *node;
-    Node *endParent;
+    friend RBTree<Key, Value, Allocator>;
+    NodeBase *node;
+    NodeBase *header;
 
     Iterator();
-    Iterator(Node *node, Node *previous = nullptr);
+    Iterator(NodeBase *node, NodeBase *header);
 
     iterator &operator++();
     iterator operator++(int);
@@ -72,8 +154,8 @@ class RBTree {
     bool operator==(const iterator &it);
     bool operator!=(const iterator &it);
 
-    Node *moveForward();
-    Node *moveBackward();
+    NodeBase *moveForward();
+    NodeBase *moveBackward();
   };
 
   class ConstIterator : public Iterator {
@@ -83,58 +165,220 @@ class RBTree {
     const_reference operator*();
   };
 
+  // Owns a node taken out of a tree until it is inserted into another one.
+  class NodeHandle {
+   public:
+    friend RBTree<Key, Value, Allocator>;
+
+    NodeHandle();
+    NodeHandle(NodeHandle &&other);
+    ~NodeHandle();
+    NodeHandle &operator=(NodeHandle &&other);
+
+    bool empty() const;
+    explicit operator bool() const;
+    key_type &key() const;
+    value_type &value() const;
+    value_type &mapped() const;
+    allocator_type get_allocator() const;
+
+   private:
+    Node *node;
+    allocator_type allocator;
+
+    NodeHandle(Node *node, const allocator_type &allocator);
+    void reset();
+  };
+
+  struct InsertReturn {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
  protected:
+  // Freezes a tree by walking its nodes directly, see s21_static_set.h.
+  template <typename, typename>
+  friend class static_set;
+  // Writes and reads snapshots node by node, see s21_snapshot.h.
+  friend class SnapshotIO;
+
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  // Ranges up to this long are erased node by node, longer ones are cut out
+  // with two splits and a join.
+  static constexpr size_type kSplitEraseMin = 32;
+  // Bounds the height of any tree, and so the stacks used to walk one.
+  static constexpr size_type kMaxHeight =
+      2 * std::numeric_limits<size_type>::digits;
+  // Lookups that find_batch runs side by side, once the nodes take more
+  // than about an L2 cache; smaller trees are searched key by key.
+  static constexpr size_type kBatchWidth = 16;
+  static constexpr size_type kBatchMinBytes = size_type(512) << 10;
+
+  // Detached subtree together with its black height, the number of black
+  // nodes on any path from its root down to a leaf.
+  struct Subtree {
+    Node *root;
+    size_type height;
+  };
+
   Node *root;
+  NodeBase header;
+  node_allocator allocator;
   enum Direction { LEFT, RIGHT };
 
+  void checkRoom();
+  template <typename... Args>
+  Node *createNode(Args &&...args);
+  void destroyNode(Node *node);
   Node *copy(Node *node, Node *parent);
-  Node *search(Node *node, key_type key);
+  Node *cloneNode(Node *node, Node *parent);
+  Node *search(Node *node, const key_type &key);
   void rotate(Node *node, Direction dir);
   std::pair<Node *, bool> insertNode(Node *node);
-  void fixInsertion(Node *node);
+  template <typename... Args>
+  std::pair<iterator, bool> emplaceUnique(const key_type &key,
+                                          Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> emplaceHint(NodeBase *hint, const key_type &key,
+                                        Args &&...args);
+  std::pair<Node *, Direction> hintedSlot(NodeBase *position,
+                                          const key_type &key, bool isMulti);
+  static bool inOrder(const key_type &first, const key_type &second,
+                      bool isMulti);
+  void attachNode(Node *node, Node *parent);
+  void attachNode(Node *node, Node *parent, Direction dir);
+  bool fixInsertion(Node *node);
   void deleteNode(Node *node);
-  void fixDeletion(Node *node);
+  void unlinkNode(Node *node);
+  Node *adoptNode(RBTree &other, Node *node);
+  Node *takeNode(node_type &nh);
+  void fixDeletion(Node *node, Node *parent);
   void replaceNode(Node *node, Node *target);
   static Node *findMin(Node *node);
   static Node *findMax(Node *node);
-  Node *findNode(Node *node, key_type key);
-  size_type calculateSize(Node *node);
+  static size_type sizeOf(Node *node);
+  void resetHeader();
+  void recount(Node *node);
+  NodeBase *lowerBound(const key_type &key);
+  NodeBase *upperBound(const key_type &key);
+  size_type rankOf(NodeBase *position);
+  NodeBase *findNode(Node *node, const key_type &key);
+  template <typename InputIt, typename Visit>
+  void searchBatch(InputIt first, InputIt last, Visit visit);
   void destroy(Node *node);
+  template <typename InputIt>
+  void assignRange(InputIt first, InputIt last, bool isSorted, bool isUnique);
+  void assignNodes(s21::vector<Node *> &nodes, bool isSorted, bool isUnique);
+  Node *buildBalanced(Node **nodes, size_type count, size_type depth,
+                      size_type redDepth, Node *parent);
+  void assignRoot(Node *node);
+  static size_type blackHeight(Node *node);
+  static Subtree detach(Node *node, size_type height);
+  Subtree join(Subtree left, Node *middle, Subtree right);
+  Subtree join(Subtree left, Subtree right);
+  Node *split(Subtree tree, const key_type &key, Subtree &left,
+              Subtree &right);
+  void splitBefore(Subtree tree, const key_type &key, Subtree &left,
+                   Subtree &right);
+  void splitAt(Subtree tree, size_type count, Subtree &left, Subtree &right);
+  Node *splitLast(Subtree tree, Subtree &rest);
+  static void appendSorted(Node *node, Node **trees, Node **separators);
+  Subtree finishSorted(Node **trees, Node **separators);
+  Subtree unite(Subtree tree, Subtree other);
+  Subtree intersect(Subtree tree, Subtree other);
+  Subtree subtract(Subtree tree, Subtree other);
 };
 
 /***************************
  * Constructors
  * *************************/
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::Node::Node()
-    : left(nullptr), parent(nullptr), right(nullptr), color(RED) {}
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::NodeBase::NodeBase(NodeColor color)
+    : left(nullptr), right(nullptr), parentAndColor(color), size(1) {}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::Node::Node(const slot_type &slot)
+    : NodeBase(RED), slot_type(slot) {}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::Node::Node(slot_type &&slot)
+    : NodeBase(RED), slot_type(std::move(slot)) {}
+
+// Builds key and value straight from the arguments, so neither needs a
+// default constructor or an assignment.
+template <typename Key, typename Value, typename Allocator>
+template <typename K, typename... Args>
+RBTree<Key, Value, Allocator>::Node::Node(std::in_place_t, K &&key,
+                                          Args &&...args)
+    : NodeBase(RED),
+      slot_type(std::in_place, std::forward<K>(key),
+                std::forward<Args>(args)...) {}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::NodeBase::parent() const {
+  static_assert(alignof(Node) > 1, "the colour bit needs an aligned parent");
+  return reinterpret_cast<Node *>(parentAndColor & ~uintptr_t(1));
+}
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::Node::Node(NodeColor color)
-    : left(nullptr), parent(nullptr), right(nullptr), color(color) {}
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::NodeBase::setParent(Node *parent) {
+  parentAndColor = reinterpret_cast<uintptr_t>(parent) | (parentAndColor & 1);
+}
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree() : root(nullptr) {}
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::NodeColor
+RBTree<Key, Value, Allocator>::NodeBase::color() const {
+  return static_cast<NodeColor>(parentAndColor & 1);
+}
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree(std::initializer_list<value_type> const &items) {
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::NodeBase::setColor(NodeColor color) {
+  parentAndColor = (parentAndColor & ~uintptr_t(1)) | color;
+}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::RBTree()
+    : root(nullptr), header(BLACK), allocator() {
+  resetHeader();
+}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::RBTree(const Allocator &alloc)
+    : root(nullptr), header(BLACK), allocator(alloc) {
+  resetHeader();
+}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::RBTree(
+    std::initializer_list<value_type> const &items)
+    : RBTree() {
   for (value_type value : items) insert(value);
 }
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree(const RBTree &other) {
-  root = RBTree<Key, Value>::copy(other.root, nullptr);
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::RBTree(const RBTree &other)
+    : RBTree(node_traits::select_on_container_copy_construction(
+          other.allocator)) {
+  root = RBTree<Key, Value, Allocator>::copy(other.root, nullptr);
+  resetHeader();
 }
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree(RBTree &&other) {
-  root = other.root;
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::RBTree(RBTree &&other)
+    : root(other.root), header(BLACK), allocator(std::move(other.allocator)) {
   other.root = nullptr;
+  resetHeader();
+  other.resetHeader();
 }
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::~RBTree() {
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::~RBTree() {
   clear();
 }
 
@@ -142,235 +386,641 @@ RBTree<Key, Value>::~RBTree() {
  * RBTree container methods (public)
  * *************************/
 
-template <typename Key, typename Value>
-RBTree<Key, Value> &RBTree<Key, Value>::operator=(RBTree &&other) {
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator> &
+RBTree<Key, Value, Allocator>::operator=(RBTree &&other) {
   if (this != &other) {
-    root = other.root;
-    other.root = nullptr;
+    clear();
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      allocator = std::move(other.allocator);
+      std::swap(root, other.root);
+    } else if (allocator == other.allocator) {
+      std::swap(root, other.root);
+    } else {
+      root = copy(other.root, nullptr);
+      other.clear();
+    }
+    resetHeader();
+    other.resetHeader();
   }
   return *this;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Node *RBTree<Key, Value>::copy(
-    RBTree<Key, Value>::Node *node, RBTree<Key, Value>::Node *parent) {
+// Clones the subtree in one pass, walking the source and the copy in step
+// through parent links instead of recursing.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::copy(Node *node, Node *parent) {
   if (node == nullptr) return nullptr;
 
-  Node *newNode = new Node();
-  newNode->value = node->value;
-  newNode->parent = parent;
-  newNode->color = node->color;
-  newNode->left = copy(node->left, newNode);
-  newNode->right = copy(node->right, newNode);
+  Node *result = cloneNode(node, parent);
+  Node *source = node, *target = result;
+  while (true) {
+    if (source->left != nullptr && target->left == nullptr) {
+      target->left = cloneNode(source->left, target);
+      source = source->left;
+      target = target->left;
+    } else if (source->right != nullptr && target->right == nullptr) {
+      target->right = cloneNode(source->right, target);
+      source = source->right;
+      target = target->right;
+    } else if (source != node) {
+      source = source->parent();
+      target = target->parent();
+    } else {
+      break;
+    }
+  }
 
-  return newNode;
+  return result;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::iterator RBTree<Key, Value>::begin() {
-  Node *node = findMin(root);
-  return Iterator(node);
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::begin() {
+  return Iterator(root != nullptr ? header.left : &header, &header);
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::iterator RBTree<Key, Value>::end() {
-  Node *node = findMax(root);
-  return Iterator(nullptr, node);
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::end() {
+  return Iterator(&header, &header);
 }
 
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::empty() {
+template <typename Key, typename Value, typename Allocator>
+bool RBTree<Key, Value, Allocator>::empty() {
   return !root;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::size_type RBTree<Key, Value>::size() {
-  return calculateSize(root);
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::size() {
+  return sizeOf(root);
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::size_type RBTree<Key, Value>::max_size() {
-  return std::numeric_limits<size_type>::max() / sizeof(Node);
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::max_size() {
+  return std::min<size_type>(std::numeric_limits<uint32_t>::max(),
+                             std::numeric_limits<size_type>::max() /
+                                 sizeof(Node));
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::clear() {
-  destroy(root);
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::clear() {
+  if (!std::is_trivially_destructible<Node>::value ||
+      !release_if_unique(allocator))
+    destroy(root);
   root = nullptr;
+  resetHeader();
 }
 
-template <typename Key, typename Value>
-typename std::pair<typename RBTree<Key, Value>::iterator, bool>
-RBTree<Key, Value>::insert(const value_type &value) {
-  Node *node = new Node();
-  node->key = value;
-  node->value = value;
+template <typename Key, typename Value, typename Allocator>
+typename std::pair<typename RBTree<Key, Value, Allocator>::iterator, bool>
+RBTree<Key, Value, Allocator>::insert(const value_type &value) {
+  return emplaceUnique(value, value);
+}
 
-  std::pair<Node *, bool> inserResult = insertNode(node);
-  bool isInserted = inserResult.second;
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::erase(iterator pos) {
+  if (root == nullptr || pos.node == nullptr || pos.node == &header) return;
+  deleteNode(static_cast<Node *>(pos.node));
+}
 
-  iterator it = Iterator(inserResult.first);
-  std::pair<iterator, bool> insertResult(it, isInserted);
-  if (!isInserted) delete node;
+// Long ranges are cut out by position rather than by key, so that equal keys
+// of a multiset outside the range stay, and the doomed nodes are freed
+// without any rebalancing: O(k + log n) for k erased elements.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::erase(iterator first, iterator last) {
+  size_type from = rankOf(first.node), to = rankOf(last.node);
+  if (to - from <= kSplitEraseMin) {
+    while (first != last) erase(first++);
+    return last;
+  }
 
-  return insertResult;
+  Subtree rest, doomed, before, after;
+  splitAt(Subtree{root, blackHeight(root)}, to, rest, after);
+  splitAt(rest, from, before, doomed);
+  destroy(doomed.root);
+  assignRoot(join(before, after).root);
+  return last;
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::erase(iterator pos) {
-  if (root == nullptr || pos.node == nullptr) return;
-  deleteNode(pos.node);
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::erase(const key_type &key) {
+  NodeBase *first = lowerBound(key), *last = upperBound(key);
+  size_type count = rankOf(last) - rankOf(first);
+  erase(Iterator(first, &header), Iterator(last, &header));
+  return count;
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::swap(RBTree &other) {
+// Erases every element for which pred returns true and returns how many.
+// pred gets the key, and for a map the mapped value too, and must not throw.
+// One in-order walk frees the doomed nodes and relinks the kept ones into a
+// new balanced tree as they come, so each node is touched once, while it is
+// in cache: O(n) however many go.
+template <typename Key, typename Value, typename Allocator>
+template <typename Pred>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::erase_if(Pred pred) {
+  Node *stack[kMaxHeight];
+  Node *trees[kMaxHeight] = {}, *separators[kMaxHeight] = {};
+  size_type depth = 0, count = 0;
+
+  for (Node *node = root; node != nullptr || depth > 0;) {
+    for (; node != nullptr; node = node->left) stack[depth++] = node;
+    node = stack[--depth];
+    Node *next = node->right;
+
+    bool matches;
+    if constexpr (std::is_void<Value>::value)
+      matches = pred(static_cast<const key_type &>(node->key));
+    else
+      matches = pred(static_cast<const key_type &>(node->key), node->mapped);
+    if (matches) {
+      destroyNode(node);
+      ++count;
+    } else {
+      appendSorted(node, trees, separators);
+    }
+    node = next;
+  }
+
+  assignRoot(finishSorted(trees, separators).root);
+  return count;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::insert_return_type
+RBTree<Key, Value, Allocator>::insert(node_type &&nh) {
+  if (nh.empty()) return InsertReturn{end(), false, node_type()};
+
+  NodeBase *existing = findNode(root, nh.node->key);
+  if (existing != &header)
+    return InsertReturn{Iterator(existing, &header), false, std::move(nh)};
+
+  checkRoom();
+  Node *node = takeNode(nh);
+  insertNode(node);
+  return InsertReturn{Iterator(node, &header), true, node_type()};
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::node_type
+RBTree<Key, Value, Allocator>::extract(iterator pos) {
+  if (root == nullptr || pos.node == nullptr || pos.node == &header)
+    return node_type();
+  Node *node = static_cast<Node *>(pos.node);
+  unlinkNode(node);
+  return node_type(node, get_allocator());
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::node_type
+RBTree<Key, Value, Allocator>::extract(const key_type &key) {
+  return extract(find(key));
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::swap(RBTree &other) {
   std::swap(root, other.root);
+  if constexpr (node_traits::propagate_on_container_swap::value)
+    std::swap(allocator, other.allocator);
+  resetHeader();
+  other.resetHeader();
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::merge(RBTree &other) {
-  RBTree constTree(other);
-  Iterator it = constTree.begin();
-  Iterator itEnd = other.end();
+// Moves every node whose key is not present here out of other, leaving the
+// duplicates behind.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::merge(RBTree &other) {
+  if (this == &other) return;
+
+  if (other.root == nullptr) return;
+
+  NodeBase *position = other.header.left;
+  while (position != &other.header) {
+    Node *node = static_cast<Node *>(position);
+    position = Iterator(node, &other.header).moveForward();
+    if (findNode(root, node->key) == &header) {
+      checkRoom();
+      insertNode(adoptNode(other, node));
+    }
+  }
+}
 
-  for (; it != itEnd; ++it) insert(*it);
-  other.clear();
+// Replaces the contents with [first, last), which must be sorted. Equal keys
+// after the first are dropped. Builds the tree in O(n) without rotations.
+template <typename Key, typename Value, typename Allocator>
+template <typename InputIt>
+void RBTree<Key, Value, Allocator>::assign_sorted(InputIt first,
+                                                  InputIt last) {
+  assignRange(first, last, true, true);
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::iterator RBTree<Key, Value>::find(
-    const key_type &key) {
-  Node *node = findNode(root, key);
-  return Iterator(node);
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::find(const key_type &key) {
+  return Iterator(findNode(root, key), &header);
 }
 
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::contains(const key_type &key) {
-  Node *node = findNode(root, key);
-  return node != nullptr;
+// Looks up every key of [first, last), which must refer to keys that stay
+// alive during the call, and writes an iterator for each to out, end() for
+// the missing ones. Faster than find in a loop once the tree outgrows the
+// cache, see searchBatch.
+template <typename Key, typename Value, typename Allocator>
+template <typename InputIt, typename OutputIt>
+OutputIt RBTree<Key, Value, Allocator>::find_batch(InputIt first,
+                                                   InputIt last,
+                                                   OutputIt out) {
+  searchBatch(first, last, [this, &out](NodeBase *node) {
+    *out++ = Iterator(node, &header);
+  });
+  return out;
+}
+
+template <typename Key, typename Value, typename Allocator>
+template <typename InputIt, typename OutputIt>
+OutputIt RBTree<Key, Value, Allocator>::contains_batch(InputIt first,
+                                                       InputIt last,
+                                                       OutputIt out) {
+  searchBatch(first, last,
+              [this, &out](NodeBase *node) { *out++ = node != &header; });
+  return out;
+}
+
+template <typename Key, typename Value, typename Allocator>
+bool RBTree<Key, Value, Allocator>::contains(const key_type &key) {
+  return findNode(root, key) != &header;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::lower_bound(const key_type &key) {
+  return Iterator(lowerBound(key), &header);
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::upper_bound(const key_type &key) {
+  return Iterator(upperBound(key), &header);
+}
+
+template <typename Key, typename Value, typename Allocator>
+std::pair<typename RBTree<Key, Value, Allocator>::iterator,
+          typename RBTree<Key, Value, Allocator>::iterator>
+RBTree<Key, Value, Allocator>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::nth(size_type k) {
+  if (k >= size()) return end();
+
+  Node *node = root;
+  while (k != sizeOf(node->left)) {
+    if (k < sizeOf(node->left)) {
+      node = node->left;
+    } else {
+      k -= sizeOf(node->left) + 1;
+      node = node->right;
+    }
+  }
+  return Iterator(node, &header);
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::rank(const key_type &key) {
+  size_type result = 0;
+  Node *node = root;
+  while (node != nullptr) {
+    if (node->key < key) {
+      result += sizeOf(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return result;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::allocator_type
+RBTree<Key, Value, Allocator>::get_allocator() {
+  return allocator_type(allocator);
 }
 
 /***************************
- * Iterator
+ * Set algebra (join-based)
  * *************************/
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::Iterator::Iterator() : node(nullptr), endParent(nullptr) {}
+// Keeps the keys less than key here and moves the rest into right,
+// replacing whatever right held before.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::split(const key_type &key,
+                                          RBTree &right) {
+  if (this == &right) return;
+  right.clear();
 
-template <typename Key, typename Value>
-RBTree<Key, Value>::Iterator::Iterator(RBTree::Node *node,
-                                       RBTree::Node *endParent)
-    : node(node), endParent(endParent) {}
+  Subtree left, greater;
+  splitBefore(Subtree{root, blackHeight(root)}, key, left, greater);
+  assignRoot(left.root);
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Node *RBTree<Key, Value>::Iterator::moveForward() {
-  if (node->right != nullptr) return findMin(node->right);
+  if (allocator == right.allocator) {
+    right.assignRoot(greater.root);
+  } else {
+    right.assignRoot(right.copy(greater.root, nullptr));
+    destroy(greater.root);
+  }
+}
 
-  Node *parent = node->parent;
-  if (parent->right == node) return node;
+// Appends every element of right, whose keys must all be greater than the
+// keys here, and leaves right empty.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::join(RBTree &right) {
+  if (this == &right || right.root == nullptr) return;
 
-  while (parent != nullptr && node == parent->right) {
-    node = parent;
-    parent = parent->parent;
+  Node *appended = right.root;
+  if (allocator == right.allocator) {
+    right.root = nullptr;
+    right.resetHeader();
+  } else {
+    appended = copy(right.root, nullptr);
+    right.clear();
   }
 
-  return parent;
+  Subtree result = join(Subtree{root, blackHeight(root)},
+                        Subtree{appended, blackHeight(appended)});
+  assignRoot(result.root);
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Node *
-RBTree<Key, Value>::Iterator::moveBackward() {
-  if (node == nullptr && endParent != nullptr) {
-    node = endParent;
-    return endParent;
+// The set operations below split this tree around the keys of other and
+// join the pieces back, O(m log(n / m + 1)) for sizes m <= n. Elements
+// already here keep their values, other is left untouched.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::set_union(const RBTree &other) {
+  if (this == &other) return;
+  Subtree result = unite(Subtree{root, blackHeight(root)},
+                         Subtree{other.root, blackHeight(other.root)});
+  assignRoot(result.root);
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::set_intersection(const RBTree &other) {
+  if (this == &other) return;
+  Subtree result = intersect(Subtree{root, blackHeight(root)},
+                             Subtree{other.root, blackHeight(other.root)});
+  assignRoot(result.root);
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::set_difference(const RBTree &other) {
+  if (this == &other) {
+    clear();
+    return;
   }
-  if (node->left != nullptr) return findMax(node->left);
+  Subtree result = subtract(Subtree{root, blackHeight(root)},
+                            Subtree{other.root, blackHeight(other.root)});
+  assignRoot(result.root);
+}
 
-  Node *parent = node->parent;
-  if (parent->left == node) return node;
+/***************************
+ * Iterator
+ * *************************/
 
-  while (parent != nullptr && node == parent->left) {
-    node = parent;
-    parent = parent->parent;
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::Iterator::Iterator()
+    : node(nullptr), header(nullptr) {}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::Iterator::Iterator(NodeBase *node,
+                                                  NodeBase *header)
+    : node(node), header(header) {}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::NodeBase *
+RBTree<Key, Value, Allocator>::Iterator::moveForward() {
+  if (node->right != nullptr) return findMin(node->right);
+
+  NodeBase *current = node;
+  Node *parent = node->parent();
+  while (parent != nullptr && current == parent->right) {
+    current = parent;
+    parent = parent->parent();
+  }
+
+  return parent == nullptr ? header : parent;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::NodeBase *
+RBTree<Key, Value, Allocator>::Iterator::moveBackward() {
+  if (node == header) return header->right;
+  if (node->left != nullptr) return findMax(node->left);
+
+  NodeBase *current = node;
+  Node *parent = node->parent();
+  while (parent != nullptr && current == parent->left) {
+    current = parent;
+    parent = parent->parent();
   }
   return parent;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::const_reference
-RBTree<Key, Value>::ConstIterator::operator*() {
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::const_reference
+RBTree<Key, Value, Allocator>::ConstIterator::operator*() {
   return (const_reference)Iterator::operator*();
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::reference
-RBTree<Key, Value>::Iterator::operator*() {
-  if (node == nullptr) {
-    static value_type fakeValue{};
-    return fakeValue;
-  }
-  return node->value;
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::reference
+RBTree<Key, Value, Allocator>::Iterator::operator*() {
+  return static_cast<Node *>(node)->value();
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::iterator &
-RBTree<Key, Value>::Iterator::operator++() {
-  Node *tmp = moveForward();
-  node = tmp == node ? nullptr : tmp;
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator &
+RBTree<Key, Value, Allocator>::Iterator::operator++() {
+  node = moveForward();
   return *this;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::iterator RBTree<Key, Value>::Iterator::operator++(
-    int) {
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::Iterator::operator++(int) {
   Iterator tmp = *this;
   operator++();
   return tmp;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::iterator &
-RBTree<Key, Value>::Iterator::operator--() {
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator &
+RBTree<Key, Value, Allocator>::Iterator::operator--() {
   node = moveBackward();
   return *this;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::iterator RBTree<Key, Value>::Iterator::operator--(
-    int) {
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::iterator
+RBTree<Key, Value, Allocator>::Iterator::operator--(int) {
   Iterator tmp = *this;
   operator--();
   return tmp;
 }
 
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::Iterator::operator==(
-    const typename RBTree<Key, Value>::iterator &it) {
+template <typename Key, typename Value, typename Allocator>
+bool RBTree<Key, Value, Allocator>::Iterator::operator==(
+    const typename RBTree<Key, Value, Allocator>::iterator &it) {
   return node == it.node;
 }
 
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::Iterator::operator!=(
-    const typename RBTree<Key, Value>::iterator &it) {
+template <typename Key, typename Value, typename Allocator>
+bool RBTree<Key, Value, Allocator>::Iterator::operator!=(
+    const typename RBTree<Key, Value, Allocator>::iterator &it) {
   return node != it.node;
 }
 
+/***************************
+ * NodeHandle
+ * *************************/
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::NodeHandle::NodeHandle()
+    : node(nullptr), allocator() {}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::NodeHandle::NodeHandle(
+    Node *node, const allocator_type &allocator)
+    : node(node), allocator(allocator) {}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::NodeHandle::NodeHandle(NodeHandle &&other)
+    : node(other.node), allocator(std::move(other.allocator)) {
+  other.node = nullptr;
+}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::NodeHandle::~NodeHandle() {
+  reset();
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::NodeHandle &
+RBTree<Key, Value, Allocator>::NodeHandle::operator=(NodeHandle &&other) {
+  if (this != &other) {
+    reset();
+    node = other.node;
+    allocator = std::move(other.allocator);
+    other.node = nullptr;
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Allocator>
+bool RBTree<Key, Value, Allocator>::NodeHandle::empty() const {
+  return node == nullptr;
+}
+
+template <typename Key, typename Value, typename Allocator>
+RBTree<Key, Value, Allocator>::NodeHandle::operator bool() const {
+  return node != nullptr;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::key_type &
+RBTree<Key, Value, Allocator>::NodeHandle::key() const {
+  return node->key;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::value_type &
+RBTree<Key, Value, Allocator>::NodeHandle::value() const {
+  return node->value();
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::value_type &
+RBTree<Key, Value, Allocator>::NodeHandle::mapped() const {
+  return node->value();
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::allocator_type
+RBTree<Key, Value, Allocator>::NodeHandle::get_allocator() const {
+  return allocator;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::NodeHandle::reset() {
+  if (node == nullptr) return;
+  node_allocator alloc(allocator);
+  node_traits::destroy(alloc, node);
+  node_traits::deallocate(alloc, node, 1);
+  node = nullptr;
+}
+
 /***************************
  * RBTree inner methods (protected)
  * *************************/
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Node *RBTree<Key, Value>::search(Node *node,
-                                                              key_type key) {
-  if (node == nullptr || key == node->key) return node;
-  if (key < node->key)
-    return search(node->left, key);
-  else
-    return search(node->right, key);
+// Subtree counts are 32-bit, so an element past max_size() would wrap them.
+// Called before a node is allocated or taken over, so nothing leaks.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::checkRoom() {
+  if (size() >= max_size()) throw std::length_error("RBTree is full");
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::rotate(Node *root, Direction dir) {
+template <typename Key, typename Value, typename Allocator>
+template <typename... Args>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::createNode(Args &&...args) {
+  Node *node = node_traits::allocate(allocator, 1);
+  try {
+    node_traits::construct(allocator, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(allocator, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::destroyNode(Node *node) {
+  node_traits::destroy(allocator, node);
+  node_traits::deallocate(allocator, node, 1);
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::cloneNode(Node *node, Node *parent) {
+  Node *newNode = createNode(static_cast<const slot_type &>(*node));
+  newNode->setParent(parent);
+  newNode->setColor(node->color());
+  newNode->size = node->size;
+  return newNode;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::search(Node *node, const key_type &key) {
+  while (node != nullptr) {
+    if (key < node->key)
+      node = node->left;
+    else if (node->key < key)
+      node = node->right;
+    else
+      break;
+  }
+  return node;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::rotate(Node *root, Direction dir) {
   bool isLeft = dir == LEFT;
   Node *target = isLeft ? root->right : root->left;
 
@@ -378,29 +1028,33 @@ void RBTree<Key, Value>::rotate(Node *root, Direction dir) {
       (!isLeft && root->left == nullptr))
     return;
 
-  target->parent = root->parent;
-  root->parent = target;
-  if (target->parent == nullptr)
+  target->setParent(root->parent());
+  root->setParent(target);
+  if (target->parent() == nullptr)
     this->root = target;
-  else if (root == target->parent->left)
-    target->parent->left = target;
+  else if (root == target->parent()->left)
+    target->parent()->left = target;
   else
-    target->parent->right = target;
+    target->parent()->right = target;
 
   if (isLeft) {
     root->right = target->left;
+    if (root->right != nullptr) root->right->setParent(root);
     target->left = root;
   } else {
     root->left = target->right;
+    if (root->left != nullptr) root->left->setParent(root);
     target->right = root;
   }
+
+  target->size = root->size;
+  root->size = 1 + sizeOf(root->left) + sizeOf(root->right);
 }
 
-template <typename Key, typename Value>
-std::pair<typename RBTree<Key, Value>::Node *, bool>
-RBTree<Key, Value>::insertNode(Node *node) {
+template <typename Key, typename Value, typename Allocator>
+std::pair<typename RBTree<Key, Value, Allocator>::Node *, bool>
+RBTree<Key, Value, Allocator>::insertNode(Node *node) {
   Node *parent = nullptr, *root = this->root;
-  node->color = RED;
 
   while (root != nullptr) {
     parent = root;
@@ -412,212 +1066,852 @@ RBTree<Key, Value>::insertNode(Node *node) {
       root = root->right;
   };
 
-  if (parent == nullptr)
+  attachNode(node, parent);
+
+  return std::pair<Node *, bool>(node, true);
+}
+
+// Searches before allocating: the node is built from args only when key is
+// missing, and key is not used after that, so it may refer into args. Keys
+// past the largest one are attached to it without a search.
+template <typename Key, typename Value, typename Allocator>
+template <typename... Args>
+std::pair<typename RBTree<Key, Value, Allocator>::iterator, bool>
+RBTree<Key, Value, Allocator>::emplaceUnique(const key_type &key,
+                                             Args &&...args) {
+  Node *parent = nullptr, *node = root;
+  if (node != nullptr && header.right->key < key) {
+    parent = header.right;
+    node = nullptr;
+  }
+  while (node != nullptr) {
+    parent = node;
+    if (key < node->key)
+      node = node->left;
+    else if (node->key < key)
+      node = node->right;
+    else
+      return std::pair<iterator, bool>(Iterator(node, &header), false);
+  }
+
+  checkRoom();
+  node = createNode(std::in_place, std::forward<Args>(args)...);
+  attachNode(node, parent);
+  return std::pair<iterator, bool>(Iterator(node, &header), true);
+}
+
+// Same as emplaceUnique, but when key belongs right next to hint no search
+// from the root is made.
+template <typename Key, typename Value, typename Allocator>
+template <typename... Args>
+std::pair<typename RBTree<Key, Value, Allocator>::iterator, bool>
+RBTree<Key, Value, Allocator>::emplaceHint(NodeBase *hint,
+                                           const key_type &key,
+                                           Args &&...args) {
+  std::pair<Node *, Direction> slot = hintedSlot(hint, key, false);
+  Node *node = slot.first == nullptr ? root : nullptr;
+  while (node != nullptr) {
+    if (key < node->key) {
+      slot = std::pair<Node *, Direction>(node, LEFT);
+      node = node->left;
+    } else if (node->key < key) {
+      slot = std::pair<Node *, Direction>(node, RIGHT);
+      node = node->right;
+    } else {
+      return std::pair<iterator, bool>(Iterator(node, &header), false);
+    }
+  }
+
+  checkRoom();
+  node = createNode(std::in_place, std::forward<Args>(args)...);
+  attachNode(node, slot.first, slot.second);
+  return std::pair<iterator, bool>(Iterator(node, &header), true);
+}
+
+// Free child slot where key goes when it belongs just before hint or, failing
+// that, just after it. Both neighbours of such a slot are checked, so the
+// order holds whatever the hint. A null parent means the hint is of no use
+// and the caller has to search from the root. Unless isMulti, a key equal to
+// a neighbour never fits, so that the search finds the existing element.
+template <typename Key, typename Value, typename Allocator>
+std::pair<typename RBTree<Key, Value, Allocator>::Node *,
+          typename RBTree<Key, Value, Allocator>::Direction>
+RBTree<Key, Value, Allocator>::hintedSlot(NodeBase *position,
+                                          const key_type &key, bool isMulti) {
+  using Slot = std::pair<Node *, Direction>;
+  if (root == nullptr || position == nullptr) return Slot(nullptr, LEFT);
+
+  // A null hint stands for end(), which has no key.
+  Node *hint = position != &header ? static_cast<Node *>(position) : nullptr;
+  if (hint == nullptr || inOrder(key, hint->key, isMulti)) {
+    if (hint == header.left) return Slot(hint, LEFT);
+    Node *before =
+        static_cast<Node *>(Iterator(position, &header).moveBackward());
+    if (!inOrder(before->key, key, isMulti)) return Slot(nullptr, LEFT);
+    if (hint != nullptr && hint->left == nullptr) return Slot(hint, LEFT);
+    return Slot(before, RIGHT);
+  }
+
+  if (!inOrder(hint->key, key, isMulti)) return Slot(nullptr, LEFT);
+  NodeBase *after = Iterator(hint, &header).moveForward();
+  if (after != &header &&
+      !inOrder(key, static_cast<Node *>(after)->key, isMulti))
+    return Slot(nullptr, LEFT);
+  if (hint->right == nullptr) return Slot(hint, RIGHT);
+  return Slot(static_cast<Node *>(after), LEFT);
+}
+
+template <typename Key, typename Value, typename Allocator>
+bool RBTree<Key, Value, Allocator>::inOrder(const key_type &first,
+                                            const key_type &second,
+                                            bool isMulti) {
+  return isMulti ? !(second < first) : first < second;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::attachNode(Node *node, Node *parent) {
+  attachNode(node, parent,
+             parent != nullptr && node->key < parent->key ? LEFT : RIGHT);
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::attachNode(Node *node, Node *parent,
+                                               Direction dir) {
+  node->left = node->right = nullptr;
+  node->setParent(parent);
+  node->setColor(RED);
+  node->size = 1;
+
+  if (parent == nullptr) {
     this->root = node;
-  else if (node->key < parent->key)
+    header.left = header.right = node;
+  } else if (dir == LEFT) {
     parent->left = node;
-  else
+    if (parent == header.left) header.left = node;
+  } else {
     parent->right = node;
+    if (parent == header.right) header.right = node;
+  }
 
-  node->parent = parent;
-
+  // Only the ancestors are touched: recomputing them from their children
+  // would also load every sibling off the path, which for appends are cold.
+  for (; parent != nullptr; parent = parent->parent()) ++parent->size;
   fixInsertion(node);
-
-  return std::pair<Node *, bool>(node, true);
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::fixInsertion(Node *node) {
-  while (node != root && node->parent->color == RED) {
-    if (node->parent == node->parent->parent->left) {
-      Node *uncle = node->parent->parent->right;
-      if (uncle != nullptr && uncle->color == RED) {
-        node->parent->color = BLACK;
-        node->color = BLACK;
-        node->parent->parent->color = RED;
-        node = node->parent->parent;
+// Returns true when the root had to be blackened, i.e. the black height grew.
+template <typename Key, typename Value, typename Allocator>
+bool RBTree<Key, Value, Allocator>::fixInsertion(Node *node) {
+  while (node != root && node->parent()->color() == RED) {
+    if (node->parent() == node->parent()->parent()->left) {
+      Node *uncle = node->parent()->parent()->right;
+      if (uncle != nullptr && uncle->color() == RED) {
+        node->parent()->setColor(BLACK);
+        uncle->setColor(BLACK);
+        node->parent()->parent()->setColor(RED);
+        node = node->parent()->parent();
       } else {
-        if (node == node->parent->right) {
-          node = node->parent;
+        if (node == node->parent()->right) {
+          node = node->parent();
           rotate(node, LEFT);
         }
-        node->parent->color = BLACK;
-        node->parent->parent->color = RED;
-        rotate(node->parent->parent, RIGHT);
+        node->parent()->setColor(BLACK);
+        node->parent()->parent()->setColor(RED);
+        rotate(node->parent()->parent(), RIGHT);
       }
     } else {
-      Node *uncle = node->parent->parent->left;
-      if (uncle != nullptr && uncle->color == RED) {
-        node->parent->color = BLACK;
-        uncle->color = BLACK;
-        node->parent->parent->color = RED;
-        node = node->parent->parent;
+      Node *uncle = node->parent()->parent()->left;
+      if (uncle != nullptr && uncle->color() == RED) {
+        node->parent()->setColor(BLACK);
+        uncle->setColor(BLACK);
+        node->parent()->parent()->setColor(RED);
+        node = node->parent()->parent();
       } else {
-        if (node == node->parent->left) {
-          node = node->parent;
+        if (node == node->parent()->left) {
+          node = node->parent();
           rotate(node, RIGHT);
         }
-        node->parent->color = BLACK;
-        node->parent->parent->color = RED;
-        rotate(node->parent->parent, LEFT);
+        node->parent()->setColor(BLACK);
+        node->parent()->parent()->setColor(RED);
+        rotate(node->parent()->parent(), LEFT);
       }
     }
   }
-  this->root->color = BLACK;
+  bool grew = this->root->color() == RED;
+  this->root->setColor(BLACK);
+  return grew;
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::deleteNode(Node *node) {
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::deleteNode(Node *node) {
   if (node == nullptr) return;
+  unlinkNode(node);
+  destroyNode(node);
+}
 
+// Removes node from the tree and rebalances, leaving the node itself alive.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::unlinkNode(Node *node) {
   Node *y = node;
   Node *x = nullptr;
-  NodeColor y_original_color = y->color;
+  Node *xParent = nullptr;
+  NodeColor y_original_color = y->color();
+
+  if (node == header.left)
+    header.left =
+        node->right != nullptr ? findMin(node->right) : node->parent();
+  if (node == header.right)
+    header.right = node->left != nullptr ? findMax(node->left) : node->parent();
 
   if (node->left == nullptr) {
     x = node->right;
+    xParent = node->parent();
     replaceNode(node, node->right);
   } else if (node->right == nullptr) {
     x = node->left;
+    xParent = node->parent();
     replaceNode(node, node->left);
   } else {
     y = findMin(node->right);
-    y_original_color = y->color;
+    y_original_color = y->color();
     x = y->right;
 
-    if (y->parent == node) {
-      if (x != nullptr) x->parent = y;
+    if (y->parent() == node) {
+      xParent = y;
     } else {
-      if (x != nullptr) x->parent = y->parent;
-
+      xParent = y->parent();
       replaceNode(y, y->right);
-      if (y->right != nullptr) y->right->parent = y;
       y->right = node->right;
-      if (y->right != nullptr) y->right->parent = y;
+      y->right->setParent(y);
     }
     replaceNode(node, y);
     y->left = node->left;
-    if (y->left != nullptr) y->left->parent = y;
-    y->color = node->color;
+    y->left->setParent(y);
+    y->setColor(node->color());
   }
 
-  if (y_original_color == BLACK && x != nullptr) fixDeletion(x);
+  recount(xParent);
+  if (y_original_color == BLACK) fixDeletion(x, xParent);
+  if (root == nullptr) resetHeader();
+}
+
+// Takes node out of other and returns it ready to be linked here. Nodes are
+// relinked when both trees share an allocator and copied otherwise.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::adoptNode(RBTree &other, Node *node) {
+  if (allocator == other.allocator) {
+    other.unlinkNode(node);
+    return node;
+  }
 
-  delete node;
+  Node *newNode = createNode(static_cast<const slot_type &>(*node));
+  other.deleteNode(node);
+  return newNode;
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::fixDeletion(Node *node) {
-  while (node != root && node != nullptr && node->color == BLACK) {
-    if (node == node->parent->left) {
-      Node *tmp = node->parent->right;
-      if (tmp->color == RED) {
-        tmp->color = BLACK;
-        node->parent->color = RED;
-        rotate(node->parent, LEFT);
-        tmp = node->parent->right;
+// Takes the node out of a handle. A handle from a tree with a different
+// allocator keeps its node and frees it, a copy is returned instead.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::takeNode(node_type &nh) {
+  if (allocator == node_allocator(nh.allocator)) {
+    Node *node = nh.node;
+    nh.node = nullptr;
+    return node;
+  }
+
+  Node *node = createNode(std::move(static_cast<slot_type &>(*nh.node)));
+  nh.reset();
+  return node;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::fixDeletion(Node *node, Node *parent) {
+  while (node != root && (node == nullptr || node->color() == BLACK)) {
+    if (node == parent->left) {
+      Node *tmp = parent->right;
+      if (tmp->color() == RED) {
+        tmp->setColor(BLACK);
+        parent->setColor(RED);
+        rotate(parent, LEFT);
+        tmp = parent->right;
       }
-      if ((tmp->left == nullptr || tmp->left->color == BLACK) &&
-          (tmp->right == nullptr || tmp->right->color == BLACK)) {
-        tmp->color = RED;
-        node = node->parent;
+      if ((tmp->left == nullptr || tmp->left->color() == BLACK) &&
+          (tmp->right == nullptr || tmp->right->color() == BLACK)) {
+        tmp->setColor(RED);
+        node = parent;
+        parent = node->parent();
       } else {
-        if (tmp->right == nullptr || tmp->right->color == BLACK) {
-          if (tmp->left != nullptr) tmp->left->color = BLACK;
-          tmp->color = RED;
+        if (tmp->right == nullptr || tmp->right->color() == BLACK) {
+          tmp->left->setColor(BLACK);
+          tmp->setColor(RED);
           rotate(tmp, RIGHT);
-          tmp = node->parent->right;
+          tmp = parent->right;
         }
-        tmp->color = node->parent->color;
-        node->parent->color = BLACK;
-        if (tmp->right != nullptr) tmp->right->color = BLACK;
-        rotate(node->parent, LEFT);
+        tmp->setColor(parent->color());
+        parent->setColor(BLACK);
+        tmp->right->setColor(BLACK);
+        rotate(parent, LEFT);
         node = root;
       }
     } else {
-      Node *tmp = node->parent->left;
-      if (tmp->color == RED) {
-        tmp->color = BLACK;
-        node->parent->color = RED;
-        rotate(node->parent, RIGHT);
-        tmp = node->parent->left;
+      Node *tmp = parent->left;
+      if (tmp->color() == RED) {
+        tmp->setColor(BLACK);
+        parent->setColor(RED);
+        rotate(parent, RIGHT);
+        tmp = parent->left;
       }
-      if ((tmp->right == nullptr || tmp->right->color == BLACK) &&
-          (tmp->left == nullptr || tmp->left->color == BLACK)) {
-        tmp->color = RED;
-        node = node->parent;
+      if ((tmp->right == nullptr || tmp->right->color() == BLACK) &&
+          (tmp->left == nullptr || tmp->left->color() == BLACK)) {
+        tmp->setColor(RED);
+        node = parent;
+        parent = node->parent();
       } else {
-        if (tmp->left == nullptr || tmp->left->color == BLACK) {
-          if (tmp->right != nullptr) tmp->right->color = BLACK;
-          tmp->color = RED;
+        if (tmp->left == nullptr || tmp->left->color() == BLACK) {
+          tmp->right->setColor(BLACK);
+          tmp->setColor(RED);
           rotate(tmp, LEFT);
-          tmp = node->parent->left;
+          tmp = parent->left;
         }
-        tmp->color = node->parent->color;
-        node->parent->color = BLACK;
-        if (tmp->left != nullptr) tmp->left->color = BLACK;
-        rotate(node->parent, RIGHT);
+        tmp->setColor(parent->color());
+        parent->setColor(BLACK);
+        tmp->left->setColor(BLACK);
+        rotate(parent, RIGHT);
         node = root;
       }
     }
   }
-  if (node != nullptr) node->color = BLACK;
+  if (node != nullptr) node->setColor(BLACK);
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::replaceNode(Node *node, Node *target) {
-  if (node->parent == nullptr)
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::replaceNode(Node *node, Node *target) {
+  if (node->parent() == nullptr)
     this->root = target;
-  else if (node == node->parent->left)
-    node->parent->left = target;
+  else if (node == node->parent()->left)
+    node->parent()->left = target;
   else
-    node->parent->right = target;
+    node->parent()->right = target;
 
-  if (target != nullptr) target->parent = node->parent;
+  if (target != nullptr) target->setParent(node->parent());
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Node *RBTree<Key, Value>::findMin(Node *node) {
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::findMin(Node *node) {
   while (node != nullptr && node->left != nullptr) node = node->left;
   return node;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Node *RBTree<Key, Value>::findMax(Node *node) {
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::findMax(Node *node) {
   while (node != nullptr && node->right != nullptr) node = node->right;
   return node;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Node *RBTree<Key, Value>::findNode(Node *node,
-                                                                key_type key) {
-  if (node && node->key == key)
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::sizeOf(Node *node) {
+  return node == nullptr ? 0 : node->size;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::resetHeader() {
+  header.left = root != nullptr ? findMin(root) : nullptr;
+  header.right = root != nullptr ? findMax(root) : nullptr;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::recount(Node *node) {
+  for (; node != nullptr; node = node->parent())
+    node->size = 1 + sizeOf(node->left) + sizeOf(node->right);
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::NodeBase *
+RBTree<Key, Value, Allocator>::lowerBound(const key_type &key) {
+  NodeBase *result = &header;
+  Node *node = root;
+  while (node != nullptr) {
+    if (node->key < key) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
+    }
+  }
+  return result;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::NodeBase *
+RBTree<Key, Value, Allocator>::upperBound(const key_type &key) {
+  NodeBase *result = &header;
+  Node *node = root;
+  while (node != nullptr) {
+    if (key < node->key) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return result;
+}
+
+// Position of node in sorted order, the header counts as size().
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::rankOf(NodeBase *position) {
+  if (position == &header) return size();
+
+  Node *node = static_cast<Node *>(position);
+  size_type result = sizeOf(node->left);
+  for (; node->parent() != nullptr; node = node->parent())
+    if (node == node->parent()->right)
+      result += sizeOf(node->parent()->left) + 1;
+  return result;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::NodeBase *
+RBTree<Key, Value, Allocator>::findNode(Node *node, const key_type &key) {
+  node = search(node, key);
+  if (node == nullptr) return &header;
+  return node;
+}
+
+// Runs up to kBatchWidth searches in lockstep, one level per round, and
+// prefetches the child each of them moves to. The cache misses of different
+// keys then overlap instead of following one another. visit gets the node
+// found for each key, or the header, in input order.
+template <typename Key, typename Value, typename Allocator>
+template <typename InputIt, typename Visit>
+void RBTree<Key, Value, Allocator>::searchBatch(InputIt first, InputIt last,
+                                                Visit visit) {
+  if (size() * sizeof(Node) < kBatchMinBytes) {
+    for (; first != last; ++first) visit(findNode(root, *first));
+    return;
+  }
+
+  const key_type *keys[kBatchWidth];
+  Node *nodes[kBatchWidth];
+  NodeBase *found[kBatchWidth];
+  while (first != last) {
+    size_type count = 0;
+    for (; first != last && count < kBatchWidth; ++first, ++count) {
+      keys[count] = std::addressof(*first);
+      nodes[count] = root;
+      found[count] = &header;
+    }
+
+    for (bool active = true; active;) {
+      active = false;
+      for (size_type i = 0; i < count; ++i) {
+        Node *node = nodes[i];
+        if (node == nullptr) continue;
+        if (*keys[i] < node->key) {
+          node = node->left;
+        } else if (node->key < *keys[i]) {
+          node = node->right;
+        } else {
+          found[i] = node;
+          node = nullptr;
+        }
+        nodes[i] = node;
+        if (node != nullptr) {
+          __builtin_prefetch(node);
+          active = true;
+        }
+      }
+    }
+
+    for (size_type i = 0; i < count; ++i) visit(found[i]);
+  }
+}
+
+// Frees the subtree bottom-up, cutting each child off its parent before
+// descending so the walk needs no stack.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::destroy(Node *node) {
+  Node *stop = node != nullptr ? node->parent() : nullptr;
+  while (node != stop) {
+    if (node->left != nullptr) {
+      Node *left = node->left;
+      node->left = nullptr;
+      node = left;
+    } else if (node->right != nullptr) {
+      Node *right = node->right;
+      node->right = nullptr;
+      node = right;
+    } else {
+      Node *parent = node->parent();
+      destroyNode(node);
+      node = parent;
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Allocator>
+template <typename InputIt>
+void RBTree<Key, Value, Allocator>::assignRange(InputIt first, InputIt last,
+                                                bool isSorted, bool isUnique) {
+  clear();
+  s21::vector<Node *> nodes;
+  for (; first != last; ++first) {
+    nodes.push_back(createNode(std::in_place, *first));
+  }
+  assignNodes(nodes, isSorted, isUnique);
+}
+
+// Links detached nodes into an empty tree. Unsorted input is stable-sorted
+// first, and for unique containers only the first of equal keys is kept.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::assignNodes(s21::vector<Node *> &nodes,
+                                                bool isSorted, bool isUnique) {
+  auto byKey = [](const Node *lhs, const Node *rhs) {
+    return lhs->key < rhs->key;
+  };
+  if (!isSorted && !std::is_sorted(nodes.begin(), nodes.end(), byKey))
+    std::stable_sort(nodes.begin(), nodes.end(), byKey);
+
+  size_type count = nodes.size();
+  if (isUnique && count > 0) {
+    size_type kept = 1;
+    for (size_type i = 1; i < count; ++i) {
+      if (nodes[kept - 1]->key < nodes[i]->key)
+        nodes[kept++] = nodes[i];
+      else
+        destroyNode(nodes[i]);
+    }
+    count = kept;
+  }
+
+  size_type redDepth = 0;
+  while ((size_type(2) << redDepth) <= count) ++redDepth;
+  root = buildBalanced(nodes.data(), count, 0, redDepth, nullptr);
+  if (root != nullptr) root->setColor(BLACK);
+  resetHeader();
+}
+
+// Middle element becomes the subtree root, so every level but the deepest is
+// full. Coloring only the deepest level red keeps black heights equal.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::buildBalanced(Node **nodes, size_type count,
+                                             size_type depth,
+                                             size_type redDepth,
+                                             Node *parent) {
+  if (count == 0) return nullptr;
+
+  size_type middle = count / 2;
+  Node *node = nodes[middle];
+  node->setParent(parent);
+  node->setColor(depth == redDepth ? RED : BLACK);
+  node->size = count;
+  node->left = buildBalanced(nodes, middle, depth + 1, redDepth, node);
+  node->right = buildBalanced(nodes + middle + 1, count - middle - 1,
+                              depth + 1, redDepth, node);
+  return node;
+}
+
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::assignRoot(Node *node) {
+  root = node;
+  if (root != nullptr) {
+    root->setParent(nullptr);
+    root->setColor(BLACK);
+  }
+  resetHeader();
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::size_type
+RBTree<Key, Value, Allocator>::blackHeight(Node *node) {
+  size_type height = 0;
+  for (; node != nullptr; node = node->left)
+    if (node->color() == BLACK) ++height;
+  return height;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Subtree
+RBTree<Key, Value, Allocator>::detach(Node *node, size_type height) {
+  if (node != nullptr) node->setParent(nullptr);
+  return Subtree{node, height};
+}
+
+// Links left, middle and right, where every key of left is less than the
+// middle key and every key of right is greater. The middle node goes down the
+// spine of the taller tree to a black node of the shorter tree's height and
+// is then fixed up like a freshly inserted red node. Uses root as scratch.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Subtree
+RBTree<Key, Value, Allocator>::join(Subtree left, Node *middle,
+                                    Subtree right) {
+  if (left.root != nullptr && left.root->color() == RED) {
+    left.root->setColor(BLACK);
+    ++left.height;
+  }
+  if (right.root != nullptr && right.root->color() == RED) {
+    right.root->setColor(BLACK);
+    ++right.height;
+  }
+
+  if (left.height == right.height) {
+    middle->setParent(nullptr);
+    middle->left = left.root;
+    middle->right = right.root;
+    middle->setColor(BLACK);
+    if (left.root != nullptr) left.root->setParent(middle);
+    if (right.root != nullptr) right.root->setParent(middle);
+    recount(middle);
+    return Subtree{middle, left.height + 1};
+  }
+
+  bool isLeftTaller = left.height > right.height;
+  Subtree tall = isLeftTaller ? left : right;
+  Subtree shorter = isLeftTaller ? right : left;
+
+  Node *parent = nullptr, *node = tall.root;
+  size_type height = tall.height;
+  while (node != nullptr && (node->color() == RED || height > shorter.height)) {
+    if (node->color() == BLACK) --height;
+    parent = node;
+    node = isLeftTaller ? node->right : node->left;
+  }
+
+  middle->setParent(parent);
+  middle->setColor(RED);
+  if (isLeftTaller) {
+    middle->left = node;
+    middle->right = shorter.root;
+    parent->right = middle;
+  } else {
+    middle->left = shorter.root;
+    middle->right = node;
+    parent->left = middle;
+  }
+  if (node != nullptr) node->setParent(middle);
+  if (shorter.root != nullptr) shorter.root->setParent(middle);
+
+  root = tall.root;
+  recount(middle);
+  bool grew = fixInsertion(middle);
+  return Subtree{root, tall.height + grew};
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Subtree
+RBTree<Key, Value, Allocator>::join(Subtree left, Subtree right) {
+  if (left.root == nullptr) return right;
+  if (right.root == nullptr) return left;
+
+  Subtree rest;
+  Node *last = splitLast(left, rest);
+  return join(rest, last, right);
+}
+
+// Cuts tree into the keys less than key and the keys greater than it.
+// Returns the detached node holding key, or nullptr.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::split(Subtree tree, const key_type &key,
+                                     Subtree &left, Subtree &right) {
+  Node *node = tree.root;
+  if (node == nullptr) {
+    left = right = Subtree{nullptr, 0};
+    return nullptr;
+  }
+
+  size_type height = tree.height - (node->color() == BLACK);
+  Subtree less = detach(node->left, height);
+  Subtree greater = detach(node->right, height);
+  Subtree middle;
+  Node *found = node;
+
+  if (key < node->key) {
+    found = split(less, key, left, middle);
+    right = join(middle, node, greater);
+  } else if (node->key < key) {
+    found = split(greater, key, middle, right);
+    left = join(less, node, middle);
+  } else {
+    left = less;
+    right = greater;
+  }
+  return found;
+}
+
+// Like split, but keys equal to key go to right, so equal keys of a
+// multiset stay together.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::splitBefore(Subtree tree,
+                                                const key_type &key,
+                                                Subtree &left,
+                                                Subtree &right) {
+  Node *node = tree.root;
+  if (node == nullptr) {
+    left = right = Subtree{nullptr, 0};
+    return;
+  }
+
+  size_type height = tree.height - (node->color() == BLACK);
+  Subtree less = detach(node->left, height);
+  Subtree greater = detach(node->right, height);
+  Subtree middle;
+
+  if (node->key < key) {
+    splitBefore(greater, key, middle, right);
+    left = join(less, node, middle);
+  } else {
+    splitBefore(less, key, left, middle);
+    right = join(middle, node, greater);
+  }
+}
+
+// Like splitBefore, but by position: the first count elements go to left.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::splitAt(Subtree tree, size_type count,
+                                            Subtree &left, Subtree &right) {
+  Node *node = tree.root;
+  if (node == nullptr) {
+    left = right = Subtree{nullptr, 0};
+    return;
+  }
+
+  size_type height = tree.height - (node->color() == BLACK);
+  size_type leftSize = sizeOf(node->left);
+  Subtree less = detach(node->left, height);
+  Subtree greater = detach(node->right, height);
+  Subtree middle;
+
+  if (leftSize < count) {
+    splitAt(greater, count - leftSize - 1, middle, right);
+    left = join(less, node, middle);
+  } else {
+    splitAt(less, count, left, middle);
+    right = join(middle, node, greater);
+  }
+}
+
+// Detaches the maximum of tree and returns it, the remainder goes to rest.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Node *
+RBTree<Key, Value, Allocator>::splitLast(Subtree tree, Subtree &rest) {
+  Node *node = tree.root;
+  size_type height = tree.height - (node->color() == BLACK);
+  Subtree less = detach(node->left, height);
+  Subtree greater = detach(node->right, height);
+
+  if (greater.root == nullptr) {
+    rest = less;
     return node;
-  else if (node == nullptr)
-    return end().node;
+  }
 
-  if (key < node->key)
-    return findNode(node->left, key);
-  else
-    return findNode(node->right, key);
+  Subtree remainder;
+  Node *last = splitLast(greater, remainder);
+  rest = join(less, node, remainder);
+  return last;
 }
 
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::size_type RBTree<Key, Value>::calculateSize(
-    Node *node) {
-  if (node == nullptr) return 0;
-  size_type leftSize = calculateSize(node->left);
-  size_type rightSize = calculateSize(node->right);
-  return 1 + leftSize + rightSize;
+// Builds a tree from nodes passed in key order, like a binary counter:
+// trees[l] is a perfect black tree of height l and separators[l] the node
+// right after it, if that level is taken. Only nodes already passed in are
+// written to, so the caller may still be reading the ones that follow.
+template <typename Key, typename Value, typename Allocator>
+void RBTree<Key, Value, Allocator>::appendSorted(Node *node, Node **trees,
+                                                 Node **separators) {
+  Node *tree = nullptr;
+  size_type level = 0;
+  for (; separators[level] != nullptr; ++level) {
+    Node *top = separators[level];
+    top->left = trees[level];
+    top->right = tree;
+    if (top->left != nullptr) top->left->setParent(top);
+    if (top->right != nullptr) top->right->setParent(top);
+    top->setColor(BLACK);
+    top->size = 1 + sizeOf(top->left) + sizeOf(top->right);
+    tree = top;
+    separators[level] = nullptr;
+  }
+  trees[level] = tree;
+  separators[level] = node;
 }
 
-template <typename Key, typename Value>
-void RBTree<Key, Value>::destroy(Node *node) {
-  if (node == nullptr) return;
-  destroy(node->left);
-  destroy(node->right);
-  delete node;
+// Joins what appendSorted left, oldest and so leftmost level first.
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Subtree
+RBTree<Key, Value, Allocator>::finishSorted(Node **trees, Node **separators) {
+  Subtree result{nullptr, 0};
+  Node *pending = nullptr;
+  for (size_type level = kMaxHeight; level-- > 0;) {
+    if (separators[level] == nullptr) continue;
+    Subtree tree = detach(trees[level], level);
+    result = pending != nullptr ? join(result, pending, tree) : tree;
+    pending = separators[level];
+  }
+  if (pending != nullptr) result = join(result, pending, Subtree{nullptr, 0});
+  return result;
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Subtree
+RBTree<Key, Value, Allocator>::unite(Subtree tree, Subtree other) {
+  if (other.root == nullptr) return tree;
+  if (tree.root == nullptr)
+    return Subtree{copy(other.root, nullptr), other.height};
+
+  Node *node = other.root;
+  size_type height = other.height - (node->color() == BLACK);
+  Subtree left, right;
+  Node *found = split(tree, node->key, left, right);
+  if (found == nullptr) {
+    found = createNode(static_cast<const slot_type &>(*node));
+  }
+
+  left = unite(left, Subtree{node->left, height});
+  right = unite(right, Subtree{node->right, height});
+  return join(left, found, right);
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Subtree
+RBTree<Key, Value, Allocator>::intersect(Subtree tree, Subtree other) {
+  if (tree.root == nullptr) return tree;
+  if (other.root == nullptr) {
+    destroy(tree.root);
+    return Subtree{nullptr, 0};
+  }
+
+  Node *node = other.root;
+  size_type height = other.height - (node->color() == BLACK);
+  Subtree left, right;
+  Node *found = split(tree, node->key, left, right);
+
+  left = intersect(left, Subtree{node->left, height});
+  right = intersect(right, Subtree{node->right, height});
+  return found != nullptr ? join(left, found, right) : join(left, right);
+}
+
+template <typename Key, typename Value, typename Allocator>
+typename RBTree<Key, Value, Allocator>::Subtree
+RBTree<Key, Value, Allocator>::subtract(Subtree tree, Subtree other) {
+  if (tree.root == nullptr || other.root == nullptr) return tree;
+
+  Node *node = other.root;
+  size_type height = other.height - (node->color() == BLACK);
+  Subtree left, right;
+  Node *found = split(tree, node->key, left, right);
+  if (found != nullptr) destroyNode(found);
+
+  left = subtract(left, Subtree{node->left, height});
+  right = subtract(right, Subtree{node->right, height});
+  return join(left, right);
 }
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
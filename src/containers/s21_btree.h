@@ -0,0 +1,775 @@
+#ifndef __S21_CONTAINERS_BTREE_H__
+#define __S21_CONTAINERS_BTREE_H__
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// B-tree keeping up to kNodeSlots sorted slots per node, with the slot array
+// sized to a few cache lines so a lookup touches one node per level. Sets
+// store bare keys (T = void), maps store key/mapped pairs. With IsMulti equal
+// keys are kept in insertion order.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+class BTree {
+ public:
+  struct Node;
+
+  class Iterator;
+  class ConstIterator;
+
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using slot_type = std::conditional_t<std::is_void<T>::value, Key,
+                                       std::pair<Key, value_type>>;
+
+  static constexpr size_type kTargetNodeBytes = 256;
+  static constexpr size_type kNodeSlots =
+      std::max<size_type>(3, std::min<size_type>(kTargetNodeBytes /
+                                                     sizeof(slot_type),
+                                                 255));
+  static constexpr size_type kMinSlots = (kNodeSlots - 1) / 2;
+
+  // Slots live in raw storage and only the first count of them are
+  // constructed, so allocating a node asks nothing of slot_type.
+  struct Node {
+    Node *parent;
+    unsigned short position;
+    unsigned short count;
+    bool leaf;
+    alignas(slot_type) unsigned char storage[kNodeSlots * sizeof(slot_type)];
+
+    slot_type *slots() {
+      return std::launder(reinterpret_cast<slot_type *>(storage));
+    }
+  };
+
+  struct InternalNode : Node {
+    Node *children[kNodeSlots + 1];
+  };
+
+  BTree();
+  explicit BTree(const Allocator &alloc);
+  BTree(const BTree &other);
+  BTree(BTree &&other);
+  ~BTree();
+  BTree &operator=(BTree &&other);
+
+  iterator begin();
+  iterator end();
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void clear();
+  void erase(iterator pos);
+  void swap(BTree &other);
+  void merge(BTree &other);
+  iterator find(const key_type &key);
+  bool contains(const key_type &key);
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  allocator_type get_allocator();
+
+  class Iterator {
+   public:
+    friend BTree<Key, T, Allocator, IsMulti>;
+    Node *node;
+    size_type position;
+    BTree *tree;
+
+    Iterator();
+    Iterator(Node *node, size_type position, BTree *tree);
+
+    iterator &operator++();
+    iterator operator++(int);
+    iterator &operator--();
+    iterator operator--(int);
+    reference operator*();
+    bool operator==(const iterator &it);
+    bool operator!=(const iterator &it);
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    ConstIterator() : Iterator(){};
+
+    const_reference operator*();
+  };
+
+ protected:
+  using leaf_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using leaf_traits = std::allocator_traits<leaf_allocator>;
+  using internal_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<InternalNode>;
+  using internal_traits = std::allocator_traits<internal_allocator>;
+
+  Node *root;
+  size_type elementCount;
+  allocator_type allocator;
+
+  template <typename Slot>
+  static const key_type &keyOf(const Slot &slot);
+  static reference valueOf(slot_type &slot);
+  static Node *&child(Node *node, size_type index);
+  static void setChild(Node *node, size_type index, Node *child);
+  static size_type lowerIndex(Node *node, const key_type &key);
+  static size_type upperIndex(Node *node, const key_type &key);
+  template <typename... Args>
+  static void constructSlot(Node *node, size_type index, Args &&...args);
+  static void destroySlot(Node *node, size_type index);
+  static void moveSlots(Node *from, size_type first, size_type last, Node *to,
+                        size_type dest);
+
+  Node *createNode(bool leaf);
+  void destroyNode(Node *node);
+  Node *copy(Node *node, Node *parent);
+  void destroy(Node *node);
+  template <typename Slot>
+  std::pair<iterator, bool> insertSlot(Slot &&slot);
+  void splitChild(Node *parent, size_type index);
+  void rebalance(Node *node);
+  void rotateLeft(Node *parent, size_type index);
+  void rotateRight(Node *parent, size_type index);
+  void mergeChildren(Node *parent, size_type index);
+};
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti>::BTree() : BTree(Allocator()) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti>::BTree(const Allocator &alloc)
+    : root(nullptr), elementCount(0), allocator(alloc) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti>::BTree(const BTree &other)
+    : BTree(std::allocator_traits<Allocator>::
+                select_on_container_copy_construction(other.allocator)) {
+  root = copy(other.root, nullptr);
+  elementCount = other.elementCount;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti>::BTree(BTree &&other)
+    : root(other.root),
+      elementCount(other.elementCount),
+      allocator(std::move(other.allocator)) {
+  other.root = nullptr;
+  other.elementCount = 0;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti>::~BTree() {
+  clear();
+}
+
+/***************************
+ * BTree container methods (public)
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti> &
+BTree<Key, T, Allocator, IsMulti>::operator=(BTree &&other) {
+  if (this != &other) {
+    clear();
+    if constexpr (std::allocator_traits<Allocator>::
+                      propagate_on_container_move_assignment::value) {
+      allocator = std::move(other.allocator);
+      std::swap(root, other.root);
+      std::swap(elementCount, other.elementCount);
+    } else if (allocator == other.allocator) {
+      std::swap(root, other.root);
+      std::swap(elementCount, other.elementCount);
+    } else {
+      root = copy(other.root, nullptr);
+      elementCount = other.elementCount;
+      other.clear();
+    }
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator
+BTree<Key, T, Allocator, IsMulti>::begin() {
+  if (root == nullptr) return end();
+
+  Node *node = root;
+  while (!node->leaf) node = child(node, 0);
+  return Iterator(node, 0, this);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator
+BTree<Key, T, Allocator, IsMulti>::end() {
+  return Iterator(nullptr, 0, this);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool BTree<Key, T, Allocator, IsMulti>::empty() {
+  return elementCount == 0;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::size_type
+BTree<Key, T, Allocator, IsMulti>::size() {
+  return elementCount;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::size_type
+BTree<Key, T, Allocator, IsMulti>::max_size() {
+  return std::numeric_limits<size_type>::max() / sizeof(slot_type);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::clear() {
+  destroy(root);
+  root = nullptr;
+  elementCount = 0;
+}
+
+// An element of an internal node is replaced by its predecessor, which always
+// sits last in a leaf, so slots are only ever removed from leaves.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::erase(iterator pos) {
+  if (pos.node == nullptr || pos.tree != this) return;
+
+  Node *node = pos.node;
+  size_type index = pos.position;
+  destroySlot(node, index);
+  if (!node->leaf) {
+    Node *leaf = child(node, index);
+    while (!leaf->leaf) leaf = child(leaf, leaf->count);
+    moveSlots(leaf, leaf->count - 1, leaf->count, node, index);
+    node = leaf;
+    index = leaf->count - 1;
+  }
+
+  moveSlots(node, index + 1, node->count, node, index);
+  --node->count;
+  --elementCount;
+  rebalance(node);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::swap(BTree &other) {
+  std::swap(root, other.root);
+  std::swap(elementCount, other.elementCount);
+  if constexpr (std::allocator_traits<
+                    Allocator>::propagate_on_container_swap::value)
+    std::swap(allocator, other.allocator);
+}
+
+// Moves every element whose key is not present here out of other, leaving
+// the duplicates behind. A rejected slot is left untouched by insertSlot, so
+// it can still be moved on into the tree that replaces other.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::merge(BTree &other) {
+  if (this == &other) return;
+
+  BTree duplicates(other.allocator);
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    slot_type &slot = it.node->slots()[it.position];
+    if (!insertSlot(std::move(slot)).second)
+      duplicates.insertSlot(std::move(slot));
+  }
+  other = std::move(duplicates);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator
+BTree<Key, T, Allocator, IsMulti>::find(const key_type &key) {
+  if constexpr (IsMulti) {
+    iterator it = lower_bound(key);
+    if (it.node != nullptr && !(key < keyOf(it.node->slots()[it.position])))
+      return it;
+  } else {
+    Node *node = root;
+    while (node != nullptr) {
+      size_type index = lowerIndex(node, key);
+      if (index < node->count && !(key < keyOf(node->slots()[index])))
+        return Iterator(node, index, this);
+      node = node->leaf ? nullptr : child(node, index);
+    }
+  }
+  return end();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool BTree<Key, T, Allocator, IsMulti>::contains(const key_type &key) {
+  return find(key) != end();
+}
+
+// The candidate found in a node is the least slot not less than key there,
+// the child to its left can only hold a closer one.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator
+BTree<Key, T, Allocator, IsMulti>::lower_bound(const key_type &key) {
+  iterator result = end();
+  Node *node = root;
+  while (node != nullptr) {
+    size_type index = lowerIndex(node, key);
+    if (index < node->count) result = Iterator(node, index, this);
+    node = node->leaf ? nullptr : child(node, index);
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator
+BTree<Key, T, Allocator, IsMulti>::upper_bound(const key_type &key) {
+  iterator result = end();
+  Node *node = root;
+  while (node != nullptr) {
+    size_type index = upperIndex(node, key);
+    if (index < node->count) result = Iterator(node, index, this);
+    node = node->leaf ? nullptr : child(node, index);
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+std::pair<typename BTree<Key, T, Allocator, IsMulti>::iterator,
+          typename BTree<Key, T, Allocator, IsMulti>::iterator>
+BTree<Key, T, Allocator, IsMulti>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::allocator_type
+BTree<Key, T, Allocator, IsMulti>::get_allocator() {
+  return allocator;
+}
+
+/***************************
+ * Iterator
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti>::Iterator::Iterator()
+    : node(nullptr), position(0), tree(nullptr) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+BTree<Key, T, Allocator, IsMulti>::Iterator::Iterator(Node *node,
+                                                      size_type position,
+                                                      BTree *tree)
+    : node(node), position(position), tree(tree) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator &
+BTree<Key, T, Allocator, IsMulti>::Iterator::operator++() {
+  if (node == nullptr) return *this;
+
+  if (!node->leaf) {
+    node = child(node, position + 1);
+    while (!node->leaf) node = child(node, 0);
+    position = 0;
+    return *this;
+  }
+
+  ++position;
+  while (node != nullptr && position == node->count) {
+    position = node->position;
+    node = node->parent;
+  }
+  if (node == nullptr) position = 0;
+  return *this;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator
+BTree<Key, T, Allocator, IsMulti>::Iterator::operator++(int) {
+  Iterator tmp = *this;
+  operator++();
+  return tmp;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator &
+BTree<Key, T, Allocator, IsMulti>::Iterator::operator--() {
+  if (node == nullptr) {
+    node = tree->root;
+    if (node == nullptr) return *this;
+    while (!node->leaf) node = child(node, node->count);
+    position = node->count - 1;
+    return *this;
+  }
+
+  if (!node->leaf) {
+    node = child(node, position);
+    while (!node->leaf) node = child(node, node->count);
+    position = node->count - 1;
+    return *this;
+  }
+
+  while (node != nullptr && position == 0) {
+    position = node->position;
+    node = node->parent;
+  }
+  if (node != nullptr) --position;
+  return *this;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::iterator
+BTree<Key, T, Allocator, IsMulti>::Iterator::operator--(int) {
+  Iterator tmp = *this;
+  operator--();
+  return tmp;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::reference
+BTree<Key, T, Allocator, IsMulti>::Iterator::operator*() {
+  return valueOf(node->slots()[position]);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::const_reference
+BTree<Key, T, Allocator, IsMulti>::ConstIterator::operator*() {
+  return (const_reference)Iterator::operator*();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool BTree<Key, T, Allocator, IsMulti>::Iterator::operator==(
+    const iterator &it) {
+  return node == it.node && position == it.position;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool BTree<Key, T, Allocator, IsMulti>::Iterator::operator!=(
+    const iterator &it) {
+  return !(*this == it);
+}
+
+/***************************
+ * BTree inner methods (protected)
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename Slot>
+const typename BTree<Key, T, Allocator, IsMulti>::key_type &
+BTree<Key, T, Allocator, IsMulti>::keyOf(const Slot &slot) {
+  if constexpr (std::is_void<T>::value)
+    return slot;
+  else
+    return slot.first;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::reference
+BTree<Key, T, Allocator, IsMulti>::valueOf(slot_type &slot) {
+  if constexpr (std::is_void<T>::value)
+    return slot;
+  else
+    return slot.second;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::Node *&
+BTree<Key, T, Allocator, IsMulti>::child(Node *node, size_type index) {
+  return static_cast<InternalNode *>(node)->children[index];
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::setChild(Node *node, size_type index,
+                                                 Node *child) {
+  static_cast<InternalNode *>(node)->children[index] = child;
+  child->parent = node;
+  child->position = static_cast<unsigned short>(index);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::size_type
+BTree<Key, T, Allocator, IsMulti>::lowerIndex(Node *node,
+                                              const key_type &key) {
+  auto less = [](const slot_type &slot, const key_type &key) {
+    return keyOf(slot) < key;
+  };
+  slot_type *slots = node->slots();
+  return std::lower_bound(slots, slots + node->count, key, less) - slots;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::size_type
+BTree<Key, T, Allocator, IsMulti>::upperIndex(Node *node,
+                                              const key_type &key) {
+  auto less = [](const key_type &key, const slot_type &slot) {
+    return key < keyOf(slot);
+  };
+  slot_type *slots = node->slots();
+  return std::upper_bound(slots, slots + node->count, key, less) - slots;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename... Args>
+void BTree<Key, T, Allocator, IsMulti>::constructSlot(Node *node,
+                                                      size_type index,
+                                                      Args &&...args) {
+  ::new (static_cast<void *>(node->slots() + index))
+      slot_type(std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::destroySlot(Node *node,
+                                                    size_type index) {
+  std::destroy_at(node->slots() + index);
+}
+
+// Relocates slots [first, last) of from to dest onwards in to: each is
+// move-constructed into raw storage and its source destroyed. Within one
+// node the range is walked from the end that does not overwrite live slots.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::moveSlots(Node *from, size_type first,
+                                                  size_type last, Node *to,
+                                                  size_type dest) {
+  auto relocate = [&](size_type i) {
+    constructSlot(to, dest + (i - first), std::move(from->slots()[i]));
+    destroySlot(from, i);
+  };
+  if (from == to && dest > first)
+    for (size_type i = last; i > first; --i) relocate(i - 1);
+  else
+    for (size_type i = first; i < last; ++i) relocate(i);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::Node *
+BTree<Key, T, Allocator, IsMulti>::createNode(bool leaf) {
+  Node *node;
+  if (leaf) {
+    leaf_allocator alloc(allocator);
+    node = leaf_traits::allocate(alloc, 1);
+    leaf_traits::construct(alloc, node);
+  } else {
+    internal_allocator alloc(allocator);
+    InternalNode *internal = internal_traits::allocate(alloc, 1);
+    internal_traits::construct(alloc, internal);
+    node = internal;
+  }
+  node->leaf = leaf;
+  return node;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::destroyNode(Node *node) {
+  if (node->leaf) {
+    leaf_allocator alloc(allocator);
+    leaf_traits::destroy(alloc, node);
+    leaf_traits::deallocate(alloc, node, 1);
+  } else {
+    internal_allocator alloc(allocator);
+    InternalNode *internal = static_cast<InternalNode *>(node);
+    internal_traits::destroy(alloc, internal);
+    internal_traits::deallocate(alloc, internal, 1);
+  }
+}
+
+// Recursion depth is the tree height, a handful of levels even for
+// billions of elements.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename BTree<Key, T, Allocator, IsMulti>::Node *
+BTree<Key, T, Allocator, IsMulti>::copy(Node *node, Node *parent) {
+  if (node == nullptr) return nullptr;
+
+  Node *newNode = createNode(node->leaf);
+  newNode->parent = parent;
+  newNode->position = node->position;
+  for (size_type i = 0; i < node->count; ++i)
+    constructSlot(newNode, i, node->slots()[i]);
+  newNode->count = node->count;
+  if (!node->leaf)
+    for (size_type i = 0; i <= node->count; ++i)
+      child(newNode, i) = copy(child(node, i), newNode);
+
+  return newNode;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::destroy(Node *node) {
+  if (node == nullptr) return;
+  if (!node->leaf)
+    for (size_type i = 0; i <= node->count; ++i) destroy(child(node, i));
+  for (size_type i = 0; i < node->count; ++i) destroySlot(node, i);
+  destroyNode(node);
+}
+
+// Top-down insertion: every full node on the way down is split first, so the
+// target leaf always has room and no split has to travel back up. Slot is
+// anything slot_type can be constructed from, and it is only consumed once
+// the key is known to go in.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename Slot>
+std::pair<typename BTree<Key, T, Allocator, IsMulti>::iterator, bool>
+BTree<Key, T, Allocator, IsMulti>::insertSlot(Slot &&slot) {
+  const key_type &key = keyOf(slot);
+  if (root == nullptr) root = createNode(true);
+  if (root->count == kNodeSlots) {
+    Node *top = createNode(false);
+    setChild(top, 0, root);
+    root = top;
+    splitChild(top, 0);
+  }
+
+  Node *node = root;
+  while (true) {
+    size_type index = IsMulti ? upperIndex(node, key) : lowerIndex(node, key);
+    if (!IsMulti && index < node->count && !(key < keyOf(node->slots()[index])))
+      return std::pair<iterator, bool>(Iterator(node, index, this), false);
+
+    if (node->leaf) {
+      moveSlots(node, index, node->count, node, index + 1);
+      try {
+        constructSlot(node, index, std::forward<Slot>(slot));
+      } catch (...) {
+        moveSlots(node, index + 1, node->count + 1, node, index);
+        throw;
+      }
+      ++node->count;
+      ++elementCount;
+      return std::pair<iterator, bool>(Iterator(node, index, this), true);
+    }
+
+    if (child(node, index)->count == kNodeSlots) {
+      splitChild(node, index);
+      const key_type &median = keyOf(node->slots()[index]);
+      if (IsMulti ? !(key < median) : median < key)
+        ++index;
+      else if (!IsMulti && !(key < median))
+        return std::pair<iterator, bool>(Iterator(node, index, this), false);
+    }
+    node = child(node, index);
+  }
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::splitChild(Node *parent,
+                                                   size_type index) {
+  Node *full = child(parent, index);
+  size_type middle = kNodeSlots / 2;
+  Node *sibling = createNode(full->leaf);
+
+  sibling->count = static_cast<unsigned short>(kNodeSlots - middle - 1);
+  moveSlots(full, middle + 1, kNodeSlots, sibling, 0);
+  if (!full->leaf)
+    for (size_type i = 0; i <= sibling->count; ++i)
+      setChild(sibling, i, child(full, middle + 1 + i));
+  full->count = static_cast<unsigned short>(middle);
+
+  moveSlots(parent, index, parent->count, parent, index + 1);
+  for (size_type i = parent->count; i > index; --i)
+    setChild(parent, i + 1, child(parent, i));
+  moveSlots(full, middle, middle + 1, parent, index);
+  setChild(parent, index + 1, sibling);
+  ++parent->count;
+}
+
+// Refills an underfull node from a sibling, or merges it with one and
+// continues at the parent, which lost a slot.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::rebalance(Node *node) {
+  while (node != root && node->count < kMinSlots) {
+    Node *parent = node->parent;
+    size_type index = node->position;
+    Node *left = index > 0 ? child(parent, index - 1) : nullptr;
+    Node *right = index < parent->count ? child(parent, index + 1) : nullptr;
+
+    if (left != nullptr && left->count > kMinSlots) {
+      rotateRight(parent, index - 1);
+      return;
+    }
+    if (right != nullptr && right->count > kMinSlots) {
+      rotateLeft(parent, index);
+      return;
+    }
+    mergeChildren(parent, left != nullptr ? index - 1 : index);
+    node = parent;
+  }
+
+  if (root->count == 0) {
+    Node *old = root;
+    root = root->leaf ? nullptr : child(root, 0);
+    if (root != nullptr) root->parent = nullptr;
+    destroyNode(old);
+  }
+}
+
+// Moves the separator at index down into the left child and the first slot
+// of the right child up in its place.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::rotateLeft(Node *parent,
+                                                   size_type index) {
+  Node *left = child(parent, index);
+  Node *right = child(parent, index + 1);
+
+  moveSlots(parent, index, index + 1, left, left->count);
+  moveSlots(right, 0, 1, parent, index);
+  moveSlots(right, 1, right->count, right, 0);
+  if (!left->leaf) {
+    setChild(left, left->count + 1, child(right, 0));
+    for (size_type i = 0; i < right->count; ++i)
+      setChild(right, i, child(right, i + 1));
+  }
+  ++left->count;
+  --right->count;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::rotateRight(Node *parent,
+                                                    size_type index) {
+  Node *left = child(parent, index);
+  Node *right = child(parent, index + 1);
+
+  moveSlots(right, 0, right->count, right, 1);
+  moveSlots(parent, index, index + 1, right, 0);
+  moveSlots(left, left->count - 1, left->count, parent, index);
+  if (!right->leaf) {
+    for (size_type i = right->count + 1; i > 0; --i)
+      setChild(right, i, child(right, i - 1));
+    setChild(right, 0, child(left, left->count));
+  }
+  --left->count;
+  ++right->count;
+}
+
+// Folds the right child at index + 1 and the separator into the left child.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void BTree<Key, T, Allocator, IsMulti>::mergeChildren(Node *parent,
+                                                      size_type index) {
+  Node *left = child(parent, index);
+  Node *right = child(parent, index + 1);
+
+  moveSlots(parent, index, index + 1, left, left->count);
+  moveSlots(right, 0, right->count, left, left->count + 1);
+  if (!left->leaf)
+    for (size_type i = 0; i <= right->count; ++i)
+      setChild(left, left->count + 1 + i, child(right, i));
+  left->count = static_cast<unsigned short>(left->count + 1 + right->count);
+
+  moveSlots(parent, index + 1, parent->count, parent, index);
+  for (size_type i = index + 1; i < parent->count; ++i)
+    setChild(parent, i, child(parent, i + 1));
+  --parent->count;
+  destroyNode(right);
+}
+}  // namespace s21
+
+#endif
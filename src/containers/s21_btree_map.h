@@ -0,0 +1,95 @@
+#ifndef __S21_CONTAINERS_BTREE_MAP_H__
+#define __S21_CONTAINERS_BTREE_MAP_H__
+
+#include <stdexcept>
+
+#include "s21_btree.h"
+
+namespace s21 {
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class btree_map : public BTree<Key, T, Allocator, false> {
+ public:
+  // Member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename BTree<Key, T, Allocator, false>::Iterator;
+  using const_iterator =
+      typename BTree<Key, T, Allocator, false>::ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // Member functions
+  btree_map() : BTree<Key, T, Allocator, false>(){};
+  explicit btree_map(const Allocator &alloc)
+      : BTree<Key, T, Allocator, false>(alloc){};
+  btree_map(std::initializer_list<value_type> const &items,
+            const Allocator &alloc = Allocator())
+      : btree_map(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  btree_map(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+      : BTree<Key, T, Allocator, false>(alloc) {
+    for (; first != last; ++first) insert(*first);
+  };
+  btree_map(const btree_map &m) : BTree<Key, T, Allocator, false>(m){};
+  btree_map(btree_map &&m) : BTree<Key, T, Allocator, false>(std::move(m)){};
+  ~btree_map() = default;
+  btree_map &operator=(btree_map &&m) = default;
+
+  // Element access
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+  // Modifiers
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename T, typename Allocator>
+T &btree_map<Key, T, Allocator>::at(const Key &key) {
+  iterator it = this->find(key);
+  if (it == this->end()) throw std::out_of_range("no such element exists");
+  return *it;
+}
+
+template <typename Key, typename T, typename Allocator>
+T &btree_map<Key, T, Allocator>::operator[](const Key &key) {
+  iterator it = this->find(key);
+  return it != this->end() ? *it : *insert(key, mapped_type()).first;
+}
+
+template <typename Key, typename T, typename Allocator>
+std::pair<typename btree_map<Key, T, Allocator>::iterator, bool>
+btree_map<Key, T, Allocator>::insert(const value_type &value) {
+  return this->insertSlot(
+      std::pair<const Key &, const T &>(value.first, value.second));
+}
+
+template <typename Key, typename T, typename Allocator>
+std::pair<typename btree_map<Key, T, Allocator>::iterator, bool>
+btree_map<Key, T, Allocator>::insert(const Key &key, const T &obj) {
+  return this->insertSlot(std::pair<const Key &, const T &>(key, obj));
+}
+
+template <typename Key, typename T, typename Allocator>
+std::pair<typename btree_map<Key, T, Allocator>::iterator, bool>
+btree_map<Key, T, Allocator>::insert_or_assign(const Key &key, const T &obj) {
+  std::pair<iterator, bool> result = insert(key, obj);
+  if (!result.second) *result.first = obj;
+  return result;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef __S21_CONTAINERS_BTREE_MULTISET_H__
+#define __S21_CONTAINERS_BTREE_MULTISET_H__
+
+#include "s21_btree.h"
+
+namespace s21 {
+template <class Key, class Allocator = std::allocator<Key>>
+class btree_multiset : public BTree<Key, void, Allocator, true> {
+ public:
+  // Member type
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename BTree<Key, void, Allocator, true>::Iterator;
+  using const_iterator =
+      typename BTree<Key, void, Allocator, true>::ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // Member functions
+  btree_multiset() : BTree<Key, void, Allocator, true>(){};
+  explicit btree_multiset(const Allocator& alloc)
+      : BTree<Key, void, Allocator, true>(alloc){};
+  btree_multiset(std::initializer_list<value_type> const& items,
+                 const Allocator& alloc = Allocator())
+      : btree_multiset(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  btree_multiset(InputIt first, InputIt last,
+                 const Allocator& alloc = Allocator())
+      : BTree<Key, void, Allocator, true>(alloc) {
+    for (; first != last; ++first) insert(*first);
+  };
+  btree_multiset(const btree_multiset& ms)
+      : BTree<Key, void, Allocator, true>(ms){};
+  btree_multiset(btree_multiset&& ms)
+      : BTree<Key, void, Allocator, true>(std::move(ms)){};
+  ~btree_multiset() = default;
+  btree_multiset& operator=(btree_multiset&& ms) {
+    BTree<Key, void, Allocator, true>::operator=(std::move(ms));
+    return *this;
+  };
+
+  // Modifiers
+  iterator insert(const value_type& value);
+
+  // Lookup
+  size_type count(const Key& key);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(std::pair(insert(std::forward<Args>(args)), true)), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename Allocator>
+typename btree_multiset<Key, Allocator>::iterator
+btree_multiset<Key, Allocator>::insert(const value_type& value) {
+  return this->insertSlot(value).first;
+}
+
+template <typename Key, typename Allocator>
+typename btree_multiset<Key, Allocator>::size_type
+btree_multiset<Key, Allocator>::count(const Key& key) {
+  size_type result = 0;
+  iterator last = this->upper_bound(key);
+  for (iterator it = this->lower_bound(key); it != last; ++it) ++result;
+  return result;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef __S21_CONTAINERS_BTREE_SET_H__
+#define __S21_CONTAINERS_BTREE_SET_H__
+
+#include "s21_btree.h"
+
+namespace s21 {
+template <typename Key, typename Allocator = std::allocator<Key>>
+class btree_set : public BTree<Key, void, Allocator, false> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const Key&;
+  using iterator = typename BTree<Key, void, Allocator, false>::Iterator;
+  using const_iterator =
+      typename BTree<Key, void, Allocator, false>::ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  btree_set() : BTree<Key, void, Allocator, false>(){};
+  explicit btree_set(const Allocator& alloc)
+      : BTree<Key, void, Allocator, false>(alloc){};
+  btree_set(std::initializer_list<Key> const& items,
+            const Allocator& alloc = Allocator())
+      : btree_set(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  btree_set(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+      : BTree<Key, void, Allocator, false>(alloc) {
+    for (; first != last; ++first) insert(*first);
+  };
+  btree_set(const btree_set& other)
+      : BTree<Key, void, Allocator, false>(other){};
+  btree_set(btree_set&& other)
+      : BTree<Key, void, Allocator, false>(std::move(other)){};
+  ~btree_set() = default;
+  btree_set& operator=(btree_set&& s) {
+    BTree<Key, void, Allocator, false>::operator=(std::move(s));
+    return *this;
+  };
+
+  std::pair<iterator, bool> insert(const value_type& value);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename Allocator>
+std::pair<typename btree_set<Key, Allocator>::iterator, bool>
+btree_set<Key, Allocator>::insert(const value_type& value) {
+  return this->insertSlot(value);
+}
+
+}  // namespace s21
+
+#endif
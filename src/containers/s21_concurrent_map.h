@@ -0,0 +1,78 @@
+#ifndef __S21_CONTAINERS_CONCURRENT_MAP_H__
+#define __S21_CONTAINERS_CONCURRENT_MAP_H__
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "s21_skip_list.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Mapped values are immutable once published: insert_or_assign swaps in a
+// new one, and at() returns a copy, since a reference could outlive the
+// epoch that keeps the value alive.
+template <typename Key, typename T>
+class concurrent_map : public SkipList<Key, T> {
+ public:
+  // Member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename SkipList<Key, T>::Iterator;
+  using const_iterator = typename SkipList<Key, T>::Iterator;
+  using size_type = size_t;
+
+  // Member functions
+  concurrent_map() : SkipList<Key, T>(){};
+  concurrent_map(std::initializer_list<value_type> const &items)
+      : SkipList<Key, T>() {
+    for (const_reference item : items) insert(item);
+  };
+  ~concurrent_map() = default;
+
+  // Element access
+  T at(const Key &key) const;
+
+  // Modifiers
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename T>
+T concurrent_map<Key, T>::at(const Key &key) const {
+  iterator it = this->find(key);
+  if (it == this->end()) throw std::out_of_range("no such element exists");
+  return *it;
+}
+
+template <typename Key, typename T>
+std::pair<typename concurrent_map<Key, T>::iterator, bool>
+concurrent_map<Key, T>::insert(const value_type &value) {
+  return this->insertNode(value.first, value.second);
+}
+
+template <typename Key, typename T>
+std::pair<typename concurrent_map<Key, T>::iterator, bool>
+concurrent_map<Key, T>::insert(const Key &key, const T &obj) {
+  return this->insertNode(key, obj);
+}
+
+template <typename Key, typename T>
+std::pair<typename concurrent_map<Key, T>::iterator, bool>
+concurrent_map<Key, T>::insert_or_assign(const Key &key, const T &obj) {
+  return this->assignNode(key, obj);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef __S21_CONTAINERS_CONCURRENT_SET_H__
+#define __S21_CONTAINERS_CONCURRENT_SET_H__
+
+#include <initializer_list>
+
+#include "s21_skip_list.h"
+#include "s21_vector.h"
+
+namespace s21 {
+template <typename Key>
+class concurrent_set : public SkipList<Key, void> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const Key&;
+  using iterator = typename SkipList<Key, void>::Iterator;
+  using const_iterator = typename SkipList<Key, void>::Iterator;
+  using size_type = size_t;
+
+  concurrent_set() : SkipList<Key, void>(){};
+  concurrent_set(std::initializer_list<Key> const& items)
+      : SkipList<Key, void>() {
+    for (const_reference item : items) insert(item);
+  };
+  ~concurrent_set() = default;
+
+  std::pair<iterator, bool> insert(const value_type& value);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key>
+std::pair<typename concurrent_set<Key>::iterator, bool>
+concurrent_set<Key>::insert(const value_type& value) {
+  return this->insertNode(value);
+}
+
+}  // namespace s21
+
+#endif
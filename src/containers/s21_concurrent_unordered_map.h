@@ -0,0 +1,274 @@
+#ifndef __S21_CONTAINERS_CONCURRENT_UNORDERED_MAP_H__
+#define __S21_CONTAINERS_CONCURRENT_UNORDERED_MAP_H__
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include "s21_unordered_map.h"
+
+namespace s21 {
+// Hash map split into independently locked shards, each an s21::unordered_map
+// behind a reader-writer lock. A key always maps to the same shard, so calls
+// on different shards never contend and readers of one shard only wait for
+// its writers. No iterators or references are handed out: lookups copy the
+// mapped value, and in-place changes go through update(), which runs under
+// the shard's exclusive lock.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class concurrent_unordered_map {
+ public:
+  // Member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type kDefaultShards = 64;
+
+  // Member functions
+  explicit concurrent_unordered_map(size_type shardCount = kDefaultShards,
+                                    const Allocator &alloc = Allocator());
+  concurrent_unordered_map(std::initializer_list<value_type> const &items,
+                           size_type shardCount = kDefaultShards,
+                           const Allocator &alloc = Allocator());
+  concurrent_unordered_map(const concurrent_unordered_map &) = delete;
+  ~concurrent_unordered_map() = default;
+  concurrent_unordered_map &operator=(const concurrent_unordered_map &) =
+      delete;
+
+  // Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type shard_count() const;
+  void reserve(size_type count);
+
+  // Lookup
+  bool find(const Key &key, T &result) const;
+  bool contains(const Key &key) const;
+
+  // Modifiers
+  bool insert(const value_type &value);
+  bool insert(const Key &key, const T &obj);
+  bool insert_or_assign(const Key &key, const T &obj);
+  bool erase(const Key &key);
+  void clear();
+  template <typename Fn>
+  bool update(const Key &key, Fn fn);
+
+  // Iteration
+  template <typename Fn>
+  void for_each(Fn fn) const;
+
+ protected:
+  using map_type = s21::unordered_map<Key, T, Hash, KeyEqual, Allocator>;
+  using iterator = typename map_type::iterator;
+
+  // Aligned to a cache line so that writers of neighbouring shards do not
+  // bounce each other's lock.
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    mutable map_type map;
+  };
+
+  std::unique_ptr<Shard[]> shards;
+  size_type shardMask;
+  Hash hash;
+
+  Shard &shardFor(const Key &key) const;
+};
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::
+    concurrent_unordered_map(size_type shardCount, const Allocator &alloc)
+    : shards(), shardMask(0), hash() {
+  size_type count = 1;
+  while (count < shardCount) count *= 2;
+  shards.reset(new Shard[count]);
+  shardMask = count - 1;
+  for (size_type i = 0; i < count; ++i) shards[i].map = map_type(alloc);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::
+    concurrent_unordered_map(std::initializer_list<value_type> const &items,
+                             size_type shardCount, const Allocator &alloc)
+    : concurrent_unordered_map(shardCount, alloc) {
+  for (const_reference item : items) insert(item);
+}
+
+/***************************
+ * concurrent_unordered_map methods (public)
+ * *************************/
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::empty()
+    const {
+  return size() == 0;
+}
+
+// Shards are counted one after another, so the result is exact only when no
+// writer runs concurrently.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::size() const {
+  size_type result = 0;
+  for (size_type i = 0; i <= shardMask; ++i) {
+    std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+    result += shards[i].map.size();
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::shard_count()
+    const {
+  return shardMask + 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::reserve(
+    size_type count) {
+  size_type perShard = count / (shardMask + 1) + 1;
+  for (size_type i = 0; i <= shardMask; ++i) {
+    std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+    shards[i].map.reserve(perShard);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::find(
+    const Key &key, T &result) const {
+  Shard &shard = shardFor(key);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  iterator it = shard.map.find(key);
+  if (it == shard.map.end()) return false;
+  result = *it;
+  return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::contains(
+    const Key &key) const {
+  Shard &shard = shardFor(key);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.contains(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(
+    const value_type &value) {
+  return insert(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(
+    const Key &key, const T &obj) {
+  Shard &shard = shardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.insert(key, obj).second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual,
+                              Allocator>::insert_or_assign(const Key &key,
+                                                           const T &obj) {
+  Shard &shard = shardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.insert_or_assign(key, obj).second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(
+    const Key &key) {
+  Shard &shard = shardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  iterator it = shard.map.find(key);
+  if (it == shard.map.end()) return false;
+  shard.map.erase(it);
+  return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::clear() {
+  for (size_type i = 0; i <= shardMask; ++i) {
+    std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+    shards[i].map.clear();
+  }
+}
+
+// Calls fn(T &) on the mapped value under the shard's exclusive lock, first
+// inserting a value-initialized one when the key is missing, so
+// read-modify-write sequences such as counters need no outer locking.
+// Returns whether the key was inserted.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <typename Fn>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::update(
+    const Key &key, Fn fn) {
+  Shard &shard = shardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  iterator it = shard.map.find(key);
+  bool inserted = it == shard.map.end();
+  if (inserted) it = shard.map.insert(key, mapped_type()).first;
+  fn(*it);
+  return inserted;
+}
+
+// Weakly consistent: calls fn(const Key &, const T &) for every element,
+// holding one shard's shared lock at a time. Each shard is seen in a
+// consistent state, but changes to other shards made meanwhile may or may
+// not be observed. fn must not call back into the map.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <typename Fn>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::for_each(
+    Fn fn) const {
+  for (size_type i = 0; i <= shardMask; ++i) {
+    std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+    for (iterator it = shards[i].map.begin(); it != shards[i].map.end(); ++it)
+      fn(static_cast<const Key &>(it.key()), static_cast<const T &>(*it));
+  }
+}
+
+/***************************
+ * concurrent_unordered_map inner methods (protected)
+ * *************************/
+
+// The shard takes bits of a separately mixed hash, so keys that share a
+// shard still spread over the whole table inside it.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::Shard &
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator>::shardFor(
+    const Key &key) const {
+  uint64_t mixed = static_cast<uint64_t>(hash(key)) * 0xC2B2AE3D27D4EB4Full;
+  return shards[static_cast<size_type>(mixed >> 40) & shardMask];
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef __S21_CONTAINERS_EPOCH_H__
+#define __S21_CONTAINERS_EPOCH_H__
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Epoch-based reclamation for the lock-free containers. A thread pins the
+// domain (through a Guard) while it may hold pointers into a shared
+// structure. Unlinked memory is retired together with the global epoch at
+// that moment and freed once the epoch has advanced twice, which can only
+// happen after every thread pinned at retirement has unpinned. A pinned
+// thread therefore never sees memory freed under it, whatever it reads.
+class EpochDomain {
+ public:
+  using deleter_type = void (*)(void *);
+
+  class Guard {
+   public:
+    Guard();
+    Guard(const Guard &other);
+    ~Guard();
+    Guard &operator=(const Guard &other);
+  };
+
+  static EpochDomain &instance();
+
+  void retire(void *ptr, deleter_type deleter);
+  void collect();
+  uint64_t epoch() const;
+
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+
+ private:
+  static constexpr size_t kCollectThreshold = 64;
+
+  // One per thread that ever pinned; epoch is 0 while the thread is not
+  // pinned. Records are reused after their thread exits, never freed
+  // before the domain is.
+  struct alignas(64) Record {
+    std::atomic<uint64_t> epoch;
+    std::atomic<bool> inUse;
+    Record *next;
+  };
+
+  struct Retired {
+    void *ptr;
+    deleter_type deleter;
+    uint64_t epoch;
+  };
+
+  struct Local {
+    Record *record = nullptr;
+    unsigned depth = 0;
+    size_t collectAt = kCollectThreshold;
+    s21::vector<Retired> limbo;
+
+    ~Local();
+  };
+
+  std::atomic<uint64_t> globalEpoch;
+  std::atomic<Record *> records;
+  std::mutex orphanMutex;
+  s21::vector<Retired> orphans;
+
+  EpochDomain();
+  ~EpochDomain();
+
+  static Local &local();
+  Record *acquireRecord();
+  void pin();
+  void unpin();
+  bool tryAdvance();
+  static void release(s21::vector<Retired> &retired, uint64_t epoch);
+};
+
+/***************************
+ * Guard
+ * *************************/
+
+inline EpochDomain::Guard::Guard() { instance().pin(); }
+
+inline EpochDomain::Guard::Guard(const Guard &) { instance().pin(); }
+
+inline EpochDomain::Guard::~Guard() { instance().unpin(); }
+
+inline EpochDomain::Guard &EpochDomain::Guard::operator=(const Guard &) {
+  return *this;
+}
+
+/***************************
+ * EpochDomain methods (public)
+ * *************************/
+
+inline EpochDomain &EpochDomain::instance() {
+  static EpochDomain domain;
+  return domain;
+}
+
+// Must be called after ptr has been made unreachable for threads that pin
+// from now on.
+inline void EpochDomain::retire(void *ptr, deleter_type deleter) {
+  Local &state = local();
+  state.limbo.push_back(
+      Retired{ptr, deleter, globalEpoch.load(std::memory_order_seq_cst)});
+  if (state.limbo.size() >= state.collectAt) collect();
+}
+
+// While some thread stays pinned the epoch cannot move, so the next attempt
+// waits for another kCollectThreshold retirements rather than rescanning the
+// limbo list on every call.
+inline void EpochDomain::collect() {
+  tryAdvance();
+  uint64_t epoch = globalEpoch.load(std::memory_order_acquire);
+  Local &state = local();
+  release(state.limbo, epoch);
+  state.collectAt = state.limbo.size() + kCollectThreshold;
+  std::unique_lock<std::mutex> lock(orphanMutex, std::try_to_lock);
+  if (lock.owns_lock()) release(orphans, epoch);
+}
+
+inline uint64_t EpochDomain::epoch() const {
+  return globalEpoch.load(std::memory_order_acquire);
+}
+
+/***************************
+ * EpochDomain inner methods (private)
+ * *************************/
+
+inline EpochDomain::EpochDomain() : globalEpoch(1), records(nullptr) {}
+
+// Runs after every thread-local Local has been destroyed, so nothing is
+// pinned any more.
+inline EpochDomain::~EpochDomain() {
+  for (Retired &item : orphans) item.deleter(item.ptr);
+  for (Record *record = records.load(); record != nullptr;) {
+    Record *next = record->next;
+    delete record;
+    record = next;
+  }
+}
+
+// Hands the remaining limbo over to the domain when the thread exits.
+inline EpochDomain::Local::~Local() {
+  EpochDomain &domain = instance();
+  {
+    std::lock_guard<std::mutex> lock(domain.orphanMutex);
+    for (Retired &item : limbo) domain.orphans.push_back(item);
+  }
+  if (record != nullptr) {
+    record->epoch.store(0, std::memory_order_release);
+    record->inUse.store(false, std::memory_order_release);
+  }
+}
+
+inline EpochDomain::Local &EpochDomain::local() {
+  static thread_local Local state;
+  return state;
+}
+
+inline EpochDomain::Record *EpochDomain::acquireRecord() {
+  for (Record *record = records.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    bool expected = false;
+    if (!record->inUse.load(std::memory_order_relaxed) &&
+        record->inUse.compare_exchange_strong(expected, true))
+      return record;
+  }
+
+  Record *record = new Record;
+  record->epoch.store(0, std::memory_order_relaxed);
+  record->inUse.store(true, std::memory_order_relaxed);
+  record->next = records.load(std::memory_order_relaxed);
+  while (!records.compare_exchange_weak(record->next, record)) {
+  }
+  return record;
+}
+
+// Nested pins are counted, only the outermost one publishes an epoch. The
+// exchange is a full barrier, so the published epoch is visible to
+// tryAdvance before this thread reads any shared pointer.
+inline void EpochDomain::pin() {
+  Local &state = local();
+  if (state.depth++ != 0) return;
+  if (state.record == nullptr) state.record = acquireRecord();
+  state.record->epoch.exchange(globalEpoch.load(std::memory_order_seq_cst),
+                               std::memory_order_seq_cst);
+}
+
+inline void EpochDomain::unpin() {
+  Local &state = local();
+  if (--state.depth == 0) {
+    state.record->epoch.store(0, std::memory_order_release);
+    if (state.limbo.size() >= state.collectAt) collect();
+  }
+}
+
+// The epoch only moves on once every pinned thread has observed it.
+inline bool EpochDomain::tryAdvance() {
+  uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+  for (Record *record = records.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    uint64_t pinned = record->epoch.load(std::memory_order_seq_cst);
+    if (pinned != 0 && pinned != epoch) return false;
+  }
+  return globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+inline void EpochDomain::release(s21::vector<Retired> &retired,
+                                 uint64_t epoch) {
+  size_t kept = 0;
+  for (size_t i = 0; i < retired.size(); ++i) {
+    if (retired[i].epoch + 2 <= epoch)
+      retired[i].deleter(retired[i].ptr);
+    else
+      retired[kept++] = retired[i];
+  }
+  while (retired.size() > kept) retired.pop_back();
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef __S21_CONTAINERS_FLAT_MAP_H__
+#define __S21_CONTAINERS_FLAT_MAP_H__
+
+#include <stdexcept>
+
+#include "s21_flat_tree.h"
+
+namespace s21 {
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class flat_map : public FlatTree<Key, T, Allocator, false> {
+ public:
+  // Member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename FlatTree<Key, T, Allocator, false>::iterator;
+  using const_iterator =
+      typename FlatTree<Key, T, Allocator, false>::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // Member functions
+  flat_map() : FlatTree<Key, T, Allocator, false>(){};
+  explicit flat_map(const Allocator &alloc)
+      : FlatTree<Key, T, Allocator, false>(alloc){};
+  flat_map(std::initializer_list<value_type> const &items,
+           const Allocator &alloc = Allocator())
+      : flat_map(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+      : FlatTree<Key, T, Allocator, false>(alloc) {
+    this->insertRange(first, last);
+  };
+  flat_map(const flat_map &m) : FlatTree<Key, T, Allocator, false>(m){};
+  flat_map(flat_map &&m) : FlatTree<Key, T, Allocator, false>(std::move(m)){};
+  ~flat_map() = default;
+  flat_map &operator=(flat_map &&m) {
+    FlatTree<Key, T, Allocator, false>::operator=(std::move(m));
+    return *this;
+  };
+
+  // Element access
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+  // Modifiers
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  void insert(InputIt first, InputIt last);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename T, typename Allocator>
+T &flat_map<Key, T, Allocator>::at(const Key &key) {
+  iterator it = this->find(key);
+  if (it == this->end()) throw std::out_of_range("no such element exists");
+  return *it;
+}
+
+template <typename Key, typename T, typename Allocator>
+T &flat_map<Key, T, Allocator>::operator[](const Key &key) {
+  return *insert(key, mapped_type()).first;
+}
+
+template <typename Key, typename T, typename Allocator>
+std::pair<typename flat_map<Key, T, Allocator>::iterator, bool>
+flat_map<Key, T, Allocator>::insert(const value_type &value) {
+  return this->insertSlot(value);
+}
+
+template <typename Key, typename T, typename Allocator>
+std::pair<typename flat_map<Key, T, Allocator>::iterator, bool>
+flat_map<Key, T, Allocator>::insert(const Key &key, const T &obj) {
+  return this->insertSlot(std::pair<const Key &, const T &>(key, obj));
+}
+
+template <typename Key, typename T, typename Allocator>
+std::pair<typename flat_map<Key, T, Allocator>::iterator, bool>
+flat_map<Key, T, Allocator>::insert_or_assign(const Key &key, const T &obj) {
+  std::pair<iterator, bool> result = insert(key, obj);
+  if (!result.second) *result.first = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Allocator>
+template <typename InputIt, typename>
+void flat_map<Key, T, Allocator>::insert(InputIt first, InputIt last) {
+  this->insertRange(first, last);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef __S21_CONTAINERS_FLAT_MULTISET_H__
+#define __S21_CONTAINERS_FLAT_MULTISET_H__
+
+#include "s21_flat_tree.h"
+
+namespace s21 {
+template <class Key, class Allocator = std::allocator<Key>>
+class flat_multiset : public FlatTree<Key, void, Allocator, true> {
+ public:
+  // Member type
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename FlatTree<Key, void, Allocator, true>::iterator;
+  using const_iterator =
+      typename FlatTree<Key, void, Allocator, true>::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // Member functions
+  flat_multiset() : FlatTree<Key, void, Allocator, true>(){};
+  explicit flat_multiset(const Allocator& alloc)
+      : FlatTree<Key, void, Allocator, true>(alloc){};
+  flat_multiset(std::initializer_list<value_type> const& items,
+                const Allocator& alloc = Allocator())
+      : flat_multiset(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  flat_multiset(InputIt first, InputIt last,
+                const Allocator& alloc = Allocator())
+      : FlatTree<Key, void, Allocator, true>(alloc) {
+    this->insertRange(first, last);
+  };
+  flat_multiset(const flat_multiset& ms)
+      : FlatTree<Key, void, Allocator, true>(ms){};
+  flat_multiset(flat_multiset&& ms)
+      : FlatTree<Key, void, Allocator, true>(std::move(ms)){};
+  ~flat_multiset() = default;
+  flat_multiset& operator=(flat_multiset&& ms) {
+    FlatTree<Key, void, Allocator, true>::operator=(std::move(ms));
+    return *this;
+  };
+
+  // Modifiers
+  iterator insert(const value_type& value);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+
+  // Lookup
+  size_type count(const Key& key);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(std::pair(insert(std::forward<Args>(args)), true)), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename Allocator>
+typename flat_multiset<Key, Allocator>::iterator
+flat_multiset<Key, Allocator>::insert(const value_type& value) {
+  return this->insertSlot(value).first;
+}
+
+template <typename Key, typename Allocator>
+template <typename InputIt>
+void flat_multiset<Key, Allocator>::insert(InputIt first, InputIt last) {
+  this->insertRange(first, last);
+}
+
+template <typename Key, typename Allocator>
+typename flat_multiset<Key, Allocator>::size_type
+flat_multiset<Key, Allocator>::count(const Key& key) {
+  return this->upperIndex(key) - this->lowerIndex(key);
+}
+
+}  // namespace s21
+
+#endif
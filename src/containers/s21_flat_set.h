@@ -0,0 +1,67 @@
+#ifndef __S21_CONTAINERS_FLAT_SET_H__
+#define __S21_CONTAINERS_FLAT_SET_H__
+
+#include "s21_flat_tree.h"
+
+namespace s21 {
+template <typename Key, typename Allocator = std::allocator<Key>>
+class flat_set : public FlatTree<Key, void, Allocator, false> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const Key&;
+  using iterator = typename FlatTree<Key, void, Allocator, false>::iterator;
+  using const_iterator =
+      typename FlatTree<Key, void, Allocator, false>::const_iterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  flat_set() : FlatTree<Key, void, Allocator, false>(){};
+  explicit flat_set(const Allocator& alloc)
+      : FlatTree<Key, void, Allocator, false>(alloc){};
+  flat_set(std::initializer_list<Key> const& items,
+           const Allocator& alloc = Allocator())
+      : flat_set(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+      : FlatTree<Key, void, Allocator, false>(alloc) {
+    this->insertRange(first, last);
+  };
+  flat_set(const flat_set& other)
+      : FlatTree<Key, void, Allocator, false>(other){};
+  flat_set(flat_set&& other)
+      : FlatTree<Key, void, Allocator, false>(std::move(other)){};
+  ~flat_set() = default;
+  flat_set& operator=(flat_set&& s) {
+    FlatTree<Key, void, Allocator, false>::operator=(std::move(s));
+    return *this;
+  };
+
+  std::pair<iterator, bool> insert(const value_type& value);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename Allocator>
+std::pair<typename flat_set<Key, Allocator>::iterator, bool>
+flat_set<Key, Allocator>::insert(const value_type& value) {
+  return this->insertSlot(value);
+}
+
+template <typename Key, typename Allocator>
+template <typename InputIt>
+void flat_set<Key, Allocator>::insert(InputIt first, InputIt last) {
+  this->insertRange(first, last);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,343 @@
+#ifndef __S21_CONTAINERS_FLAT_TREE_H__
+#define __S21_CONTAINERS_FLAT_TREE_H__
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+template <typename T, typename Allocator>
+struct FlatValues {
+  s21::vector<T, Allocator> data;
+
+  explicit FlatValues(const Allocator &alloc) : data(alloc) {}
+};
+
+template <typename Allocator>
+struct FlatValues<void, Allocator> {
+  explicit FlatValues(const Allocator &) {}
+};
+
+// Sorted keys in one s21::vector and, for maps, mapped values at the same
+// indices in a second one. Iterators are plain pointers into the value array
+// (the key array for sets). Single inserts shift the tail; batch inserts
+// sort the new elements and merge them with the old ones in one pass.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+class FlatTree {
+ public:
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  FlatTree();
+  explicit FlatTree(const Allocator &alloc);
+  FlatTree(const FlatTree &other) = default;
+  FlatTree(FlatTree &&other) = default;
+  ~FlatTree() = default;
+  FlatTree &operator=(FlatTree &&other);
+
+  iterator begin();
+  iterator end();
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void reserve(size_type size);
+  void shrink_to_fit();
+  void clear();
+  void erase(iterator pos);
+  void swap(FlatTree &other);
+  void merge(FlatTree &other);
+  iterator find(const key_type &key);
+  bool contains(const key_type &key);
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  const key_type &key_at(const_iterator pos);
+  allocator_type get_allocator();
+
+ protected:
+  using key_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Key>;
+  using mapped_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<value_type>;
+
+  allocator_type allocator;
+  s21::vector<Key, key_allocator> keys;
+  FlatValues<T, mapped_allocator> values;
+
+  size_type lowerIndex(const key_type &key);
+  size_type upperIndex(const key_type &key);
+  template <typename Slot>
+  std::pair<iterator, bool> insertSlot(const Slot &slot);
+  template <typename InputIt>
+  void insertRange(InputIt first, InputIt last);
+  template <typename Slot>
+  static const key_type &keyOf(const Slot &slot);
+};
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+FlatTree<Key, T, Allocator, IsMulti>::FlatTree() : FlatTree(Allocator()) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+FlatTree<Key, T, Allocator, IsMulti>::FlatTree(const Allocator &alloc)
+    : allocator(alloc),
+      keys(key_allocator(alloc)),
+      values(mapped_allocator(alloc)) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+FlatTree<Key, T, Allocator, IsMulti> &
+FlatTree<Key, T, Allocator, IsMulti>::operator=(FlatTree &&other) {
+  if (this != &other) {
+    allocator = std::move(other.allocator);
+    keys = std::move(other.keys);
+    if constexpr (!std::is_void<T>::value)
+      values.data = std::move(other.values.data);
+  }
+  return *this;
+}
+
+/***************************
+ * FlatTree container methods (public)
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::iterator
+FlatTree<Key, T, Allocator, IsMulti>::begin() {
+  if constexpr (std::is_void<T>::value)
+    return keys.begin();
+  else
+    return values.data.begin();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::iterator
+FlatTree<Key, T, Allocator, IsMulti>::end() {
+  return begin() + keys.size();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool FlatTree<Key, T, Allocator, IsMulti>::empty() {
+  return keys.empty();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::size_type
+FlatTree<Key, T, Allocator, IsMulti>::size() {
+  return keys.size();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::size_type
+FlatTree<Key, T, Allocator, IsMulti>::max_size() {
+  return keys.max_size();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void FlatTree<Key, T, Allocator, IsMulti>::reserve(size_type size) {
+  keys.reserve(size);
+  if constexpr (!std::is_void<T>::value) values.data.reserve(size);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void FlatTree<Key, T, Allocator, IsMulti>::shrink_to_fit() {
+  keys.shrink_to_fit();
+  if constexpr (!std::is_void<T>::value) values.data.shrink_to_fit();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void FlatTree<Key, T, Allocator, IsMulti>::clear() {
+  keys.clear();
+  if constexpr (!std::is_void<T>::value) values.data.clear();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void FlatTree<Key, T, Allocator, IsMulti>::erase(iterator pos) {
+  if (pos < begin() || pos >= end()) return;
+
+  size_type index = pos - begin();
+  keys.erase(keys.begin() + index);
+  if constexpr (!std::is_void<T>::value)
+    values.data.erase(values.data.begin() + index);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void FlatTree<Key, T, Allocator, IsMulti>::swap(FlatTree &other) {
+  std::swap(allocator, other.allocator);
+  keys.swap(other.keys);
+  if constexpr (!std::is_void<T>::value) values.data.swap(other.values.data);
+}
+
+// Moves every element whose key is not present here out of other in one
+// merge pass, leaving the duplicates behind.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void FlatTree<Key, T, Allocator, IsMulti>::merge(FlatTree &other) {
+  if (this == &other) return;
+
+  FlatTree duplicates(other.allocator);
+  for (size_type i = 0; i < other.keys.size(); ++i) {
+    if (!IsMulti && contains(other.keys[i])) {
+      duplicates.keys.push_back(other.keys[i]);
+      if constexpr (!std::is_void<T>::value)
+        duplicates.values.data.push_back(other.values.data[i]);
+    }
+  }
+
+  if constexpr (std::is_void<T>::value) {
+    insertRange(other.keys.begin(), other.keys.end());
+  } else {
+    s21::vector<std::pair<Key, T>> slots;
+    slots.reserve(other.keys.size());
+    for (size_type i = 0; i < other.keys.size(); ++i)
+      slots.push_back(std::pair<Key, T>(other.keys[i], other.values.data[i]));
+    insertRange(slots.begin(), slots.end());
+  }
+  other.swap(duplicates);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::iterator
+FlatTree<Key, T, Allocator, IsMulti>::find(const key_type &key) {
+  size_type index = lowerIndex(key);
+  if (index < keys.size() && !(key < keys[index])) return begin() + index;
+  return end();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool FlatTree<Key, T, Allocator, IsMulti>::contains(const key_type &key) {
+  return find(key) != end();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::iterator
+FlatTree<Key, T, Allocator, IsMulti>::lower_bound(const key_type &key) {
+  return begin() + lowerIndex(key);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::iterator
+FlatTree<Key, T, Allocator, IsMulti>::upper_bound(const key_type &key) {
+  return begin() + upperIndex(key);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+std::pair<typename FlatTree<Key, T, Allocator, IsMulti>::iterator,
+          typename FlatTree<Key, T, Allocator, IsMulti>::iterator>
+FlatTree<Key, T, Allocator, IsMulti>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+const typename FlatTree<Key, T, Allocator, IsMulti>::key_type &
+FlatTree<Key, T, Allocator, IsMulti>::key_at(const_iterator pos) {
+  return keys[pos - begin()];
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::allocator_type
+FlatTree<Key, T, Allocator, IsMulti>::get_allocator() {
+  return allocator;
+}
+
+/***************************
+ * FlatTree inner methods (protected)
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::size_type
+FlatTree<Key, T, Allocator, IsMulti>::lowerIndex(const key_type &key) {
+  return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename FlatTree<Key, T, Allocator, IsMulti>::size_type
+FlatTree<Key, T, Allocator, IsMulti>::upperIndex(const key_type &key) {
+  return std::upper_bound(keys.begin(), keys.end(), key) - keys.begin();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename Slot>
+const typename FlatTree<Key, T, Allocator, IsMulti>::key_type &
+FlatTree<Key, T, Allocator, IsMulti>::keyOf(const Slot &slot) {
+  if constexpr (std::is_void<T>::value)
+    return slot;
+  else
+    return slot.first;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename Slot>
+std::pair<typename FlatTree<Key, T, Allocator, IsMulti>::iterator, bool>
+FlatTree<Key, T, Allocator, IsMulti>::insertSlot(const Slot &slot) {
+  const key_type &key = keyOf(slot);
+  size_type index = IsMulti ? upperIndex(key) : lowerIndex(key);
+  if (!IsMulti && index < keys.size() && !(key < keys[index]))
+    return std::pair<iterator, bool>(begin() + index, false);
+
+  keys.insert(keys.begin() + index, key);
+  if constexpr (!std::is_void<T>::value)
+    values.data.insert(values.data.begin() + index, slot.second);
+  return std::pair<iterator, bool>(begin() + index, true);
+}
+
+// Appends the new elements to scratch arrays, sorts them stably by key and
+// merges them with the current contents, O(n + m log m). Existing elements
+// win over new ones with an equal key, and among new ones the first wins.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename InputIt>
+void FlatTree<Key, T, Allocator, IsMulti>::insertRange(InputIt first,
+                                                       InputIt last) {
+  FlatTree added(allocator);
+  for (; first != last; ++first) {
+    added.keys.push_back(keyOf(*first));
+    if constexpr (!std::is_void<T>::value)
+      added.values.data.push_back(first->second);
+  }
+  size_type count = added.keys.size();
+  if (count == 0) return;
+
+  s21::vector<size_type> order;
+  order.reserve(count);
+  for (size_type i = 0; i < count; ++i) order.push_back(i);
+  std::stable_sort(order.begin(), order.end(),
+                   [&added](size_type lhs, size_type rhs) {
+                     return added.keys[lhs] < added.keys[rhs];
+                   });
+
+  FlatTree merged(allocator);
+  merged.reserve(keys.size() + count);
+  auto take = [&merged](FlatTree &from, size_type index) {
+    if (!IsMulti && !merged.keys.empty() &&
+        !(merged.keys.back() < from.keys[index]))
+      return;
+    merged.keys.push_back(from.keys[index]);
+    if constexpr (!std::is_void<T>::value)
+      merged.values.data.push_back(from.values.data[index]);
+  };
+
+  size_type old = 0, fresh = 0;
+  while (old < keys.size() || fresh < count) {
+    if (fresh == count ||
+        (old < keys.size() && !(added.keys[order[fresh]] < keys[old])))
+      take(*this, old++);
+    else
+      take(added, order[fresh++]);
+  }
+  swap(merged);
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,676 @@
+#ifndef __S21_CONTAINERS_HASH_TABLE_H__
+#define __S21_CONTAINERS_HASH_TABLE_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Open addressing in the style of Swiss tables. Every slot has a control byte
+// holding the low 7 bits of the hash when the slot is full, or kEmpty /
+// kDeleted. Control bytes are scanned a group of 16 at a time (one SSE2
+// compare when available), so a lookup usually reads one group and compares
+// a single key. Keys (and mapped values) are stored inline in the slot array.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+class HashTable {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using slot_type = std::conditional_t<std::is_void<T>::value, Key,
+                                       std::pair<Key, value_type>>;
+  using ctrl_type = signed char;
+
+  static constexpr size_type kGroupWidth = 16;
+  static constexpr ctrl_type kEmpty = -128;
+  static constexpr ctrl_type kDeleted = -2;
+
+  HashTable();
+  explicit HashTable(const Allocator &alloc);
+  HashTable(const HashTable &other);
+  HashTable(HashTable &&other);
+  ~HashTable();
+  HashTable &operator=(HashTable &&other);
+
+  iterator begin();
+  iterator end();
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void clear();
+  void erase(iterator pos);
+  void swap(HashTable &other);
+  void merge(HashTable &other);
+  iterator find(const key_type &key);
+  bool contains(const key_type &key);
+  void reserve(size_type count);
+  size_type bucket_count();
+  float load_factor();
+  allocator_type get_allocator();
+
+  class Iterator {
+   public:
+    friend HashTable<Key, T, Hash, KeyEqual, Allocator>;
+    HashTable *table;
+    size_type index;
+
+    Iterator();
+    Iterator(HashTable *table, size_type index);
+
+    iterator &operator++();
+    iterator operator++(int);
+    reference operator*();
+    const key_type &key();
+    bool operator==(const iterator &it);
+    bool operator!=(const iterator &it);
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    ConstIterator() : Iterator(){};
+
+    const_reference operator*();
+  };
+
+ protected:
+  using ctrl_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<ctrl_type>;
+  using slot_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<slot_type>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+  ctrl_type *ctrl;
+  slot_type *slots;
+  size_type capacity;
+  size_type elementCount;
+  size_type growthLeft;
+  allocator_type allocator;
+  hasher hash;
+  key_equal equal;
+
+  static uint32_t matchByte(const ctrl_type *group, ctrl_type byte);
+  static uint32_t matchEmpty(const ctrl_type *group);
+  static uint32_t matchFree(const ctrl_type *group);
+  static size_type mix(size_type hash);
+  static size_type growthFor(size_type capacity);
+  template <typename Slot>
+  static const key_type &keyOf(const Slot &slot);
+  static reference valueOf(slot_type &slot);
+
+  size_type hashOf(const key_type &key);
+  size_type findIndex(const key_type &key, size_type hash);
+  size_type findFree(size_type hash);
+  template <typename Slot>
+  std::pair<iterator, bool> insertSlot(Slot &&slot);
+  void resize(size_type newCapacity);
+  void allocateTable(size_type newCapacity);
+  void destroySlots();
+  void releaseTable();
+  void copyFrom(const HashTable &other);
+  void swapTable(HashTable &other);
+};
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::HashTable()
+    : HashTable(Allocator()) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::HashTable(const Allocator &alloc)
+    : ctrl(nullptr),
+      slots(nullptr),
+      capacity(0),
+      elementCount(0),
+      growthLeft(0),
+      allocator(alloc),
+      hash(),
+      equal() {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::HashTable(const HashTable &other)
+    : HashTable(std::allocator_traits<Allocator>::
+                    select_on_container_copy_construction(other.allocator)) {
+  hash = other.hash;
+  equal = other.equal;
+  copyFrom(other);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::HashTable(HashTable &&other)
+    : ctrl(other.ctrl),
+      slots(other.slots),
+      capacity(other.capacity),
+      elementCount(other.elementCount),
+      growthLeft(other.growthLeft),
+      allocator(std::move(other.allocator)),
+      hash(std::move(other.hash)),
+      equal(std::move(other.equal)) {
+  other.ctrl = nullptr;
+  other.slots = nullptr;
+  other.capacity = 0;
+  other.elementCount = 0;
+  other.growthLeft = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::~HashTable() {
+  destroySlots();
+  releaseTable();
+}
+
+/***************************
+ * HashTable container methods (public)
+ * *************************/
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator> &
+HashTable<Key, T, Hash, KeyEqual, Allocator>::operator=(HashTable &&other) {
+  if (this != &other) {
+    destroySlots();
+    releaseTable();
+    hash = std::move(other.hash);
+    equal = std::move(other.equal);
+    if constexpr (std::allocator_traits<Allocator>::
+                      propagate_on_container_move_assignment::value) {
+      allocator = std::move(other.allocator);
+      swapTable(other);
+    } else if (allocator == other.allocator) {
+      swapTable(other);
+    } else {
+      copyFrom(other);
+      other.clear();
+    }
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::iterator
+HashTable<Key, T, Hash, KeyEqual, Allocator>::begin() {
+  size_type index = 0;
+  while (index < capacity && ctrl[index] < 0) ++index;
+  return Iterator(this, index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::iterator
+HashTable<Key, T, Hash, KeyEqual, Allocator>::end() {
+  return Iterator(this, capacity);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool HashTable<Key, T, Hash, KeyEqual, Allocator>::empty() {
+  return elementCount == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::size() {
+  return elementCount;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::max_size() {
+  slot_allocator alloc(allocator);
+  return slot_traits::max_size(alloc);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::clear() {
+  destroySlots();
+  std::fill(ctrl, ctrl + capacity, kEmpty);
+  elementCount = 0;
+  growthLeft = growthFor(capacity);
+}
+
+// A slot may only become empty again if its group still has an empty byte:
+// such a group never stopped a probe from going on, so no probe sequence
+// passes through it. Otherwise it is left as a tombstone until the next
+// rehash.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::erase(iterator pos) {
+  if (pos.table != this || pos.index >= capacity || ctrl[pos.index] < 0)
+    return;
+
+  slot_allocator alloc(allocator);
+  slot_traits::destroy(alloc, slots + pos.index);
+  --elementCount;
+  if (matchEmpty(ctrl + pos.index / kGroupWidth * kGroupWidth)) {
+    ctrl[pos.index] = kEmpty;
+    ++growthLeft;
+  } else {
+    ctrl[pos.index] = kDeleted;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::swap(HashTable &other) {
+  swapTable(other);
+  std::swap(hash, other.hash);
+  std::swap(equal, other.equal);
+  if constexpr (std::allocator_traits<
+                    Allocator>::propagate_on_container_swap::value)
+    std::swap(allocator, other.allocator);
+}
+
+// Moves every element whose key is not present here out of other, leaving
+// the duplicates behind.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::merge(HashTable &other) {
+  if (this == &other) return;
+
+  reserve(elementCount + other.elementCount);
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    if (!contains(it.key())) {
+      insertSlot(std::move(other.slots[it.index]));
+      other.erase(it);
+    }
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::iterator
+HashTable<Key, T, Hash, KeyEqual, Allocator>::find(const key_type &key) {
+  return Iterator(this, findIndex(key, hashOf(key)));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool HashTable<Key, T, Hash, KeyEqual, Allocator>::contains(
+    const key_type &key) {
+  return findIndex(key, hashOf(key)) != capacity;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::reserve(size_type count) {
+  size_type newCapacity = kGroupWidth;
+  while (growthFor(newCapacity) < count) newCapacity *= 2;
+  if (newCapacity > capacity) resize(newCapacity);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::bucket_count() {
+  return capacity;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+float HashTable<Key, T, Hash, KeyEqual, Allocator>::load_factor() {
+  return capacity ? static_cast<float>(elementCount) / capacity : 0.0f;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::allocator_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::get_allocator() {
+  return allocator;
+}
+
+/***************************
+ * Iterator methods
+ * *************************/
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::Iterator()
+    : table(nullptr), index(0) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::Iterator(
+    HashTable *table, size_type index)
+    : table(table), index(index) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::iterator &
+HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::operator++() {
+  do {
+    ++index;
+  } while (index < table->capacity && table->ctrl[index] < 0);
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::iterator
+HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::operator++(int) {
+  iterator tmp = *this;
+  ++(*this);
+  return tmp;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::reference
+HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::operator*() {
+  return valueOf(table->slots[index]);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+const typename HashTable<Key, T, Hash, KeyEqual, Allocator>::key_type &
+HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::key() {
+  return keyOf(table->slots[index]);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::operator==(
+    const iterator &it) {
+  return index == it.index;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+bool HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator::operator!=(
+    const iterator &it) {
+  return !(*this == it);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::const_reference
+HashTable<Key, T, Hash, KeyEqual, Allocator>::ConstIterator::operator*() {
+  return Iterator::operator*();
+}
+
+/***************************
+ * HashTable inner methods (protected)
+ * *************************/
+
+// Bit i of the result is set when control byte i of the group matches.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+uint32_t HashTable<Key, T, Hash, KeyEqual, Allocator>::matchByte(
+    const ctrl_type *group, ctrl_type byte) {
+#if defined(__SSE2__)
+  __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(byte), bytes)));
+#else
+  uint32_t mask = 0;
+  for (size_type i = 0; i < kGroupWidth; ++i)
+    if (group[i] == byte) mask |= 1u << i;
+  return mask;
+#endif
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+uint32_t HashTable<Key, T, Hash, KeyEqual, Allocator>::matchEmpty(
+    const ctrl_type *group) {
+  return matchByte(group, kEmpty);
+}
+
+// Empty and deleted bytes are the only negative ones.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+uint32_t HashTable<Key, T, Hash, KeyEqual, Allocator>::matchFree(
+    const ctrl_type *group) {
+#if defined(__SSE2__)
+  return static_cast<uint32_t>(_mm_movemask_epi8(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(group))));
+#else
+  uint32_t mask = 0;
+  for (size_type i = 0; i < kGroupWidth; ++i)
+    if (group[i] < 0) mask |= 1u << i;
+  return mask;
+#endif
+}
+
+// std::hash is the identity for integers, so spread every input bit over
+// both the 7 bits kept in the control byte and the bits choosing the group.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::mix(size_type hash) {
+  uint64_t product = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_type>(product ^ (product >> 32));
+}
+
+// Keeps the load factor at or below 7/8.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::growthFor(size_type capacity) {
+  return capacity - capacity / 8;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <typename Slot>
+const typename HashTable<Key, T, Hash, KeyEqual, Allocator>::key_type &
+HashTable<Key, T, Hash, KeyEqual, Allocator>::keyOf(const Slot &slot) {
+  if constexpr (std::is_void<T>::value)
+    return slot;
+  else
+    return slot.first;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::reference
+HashTable<Key, T, Hash, KeyEqual, Allocator>::valueOf(slot_type &slot) {
+  if constexpr (std::is_void<T>::value)
+    return slot;
+  else
+    return slot.second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::hashOf(const key_type &key) {
+  return mix(hash(key));
+}
+
+// Probes groups in triangular order, which visits every group once when the
+// group count is a power of two. Returns capacity when the key is missing.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::findIndex(const key_type &key,
+                                                        size_type hash) {
+  if (capacity == 0) return capacity;
+
+  ctrl_type fingerprint = static_cast<ctrl_type>(hash & 0x7F);
+  size_type mask = capacity / kGroupWidth - 1;
+  size_type group = (hash >> 7) & mask;
+  for (size_type probe = 1;; ++probe) {
+    const ctrl_type *bytes = ctrl + group * kGroupWidth;
+    for (uint32_t match = matchByte(bytes, fingerprint); match;
+         match &= match - 1) {
+      size_type index = group * kGroupWidth + __builtin_ctz(match);
+      if (equal(keyOf(slots[index]), key)) return index;
+    }
+    if (matchEmpty(bytes)) return capacity;
+    group = (group + probe) & mask;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+typename HashTable<Key, T, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, T, Hash, KeyEqual, Allocator>::findFree(size_type hash) {
+  size_type mask = capacity / kGroupWidth - 1;
+  size_type group = (hash >> 7) & mask;
+  for (size_type probe = 1;; ++probe) {
+    uint32_t match = matchFree(ctrl + group * kGroupWidth);
+    if (match) return group * kGroupWidth + __builtin_ctz(match);
+    group = (group + probe) & mask;
+  }
+}
+
+// Slot is anything slot_type can be constructed from, e.g. a pair of
+// references, so nothing is copied when the key is already present.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <typename Slot>
+std::pair<typename HashTable<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+HashTable<Key, T, Hash, KeyEqual, Allocator>::insertSlot(Slot &&slot) {
+  const key_type &key = keyOf(slot);
+  size_type slotHash = hashOf(key);
+  size_type index = findIndex(key, slotHash);
+  if (index != capacity)
+    return std::pair<iterator, bool>(iterator(this, index), false);
+
+  if (growthLeft == 0)
+    resize(capacity == 0 ? kGroupWidth
+           : elementCount < capacity / 2 ? capacity
+                                         : capacity * 2);
+  index = findFree(slotHash);
+  slot_allocator alloc(allocator);
+  slot_traits::construct(alloc, slots + index, std::forward<Slot>(slot));
+  if (ctrl[index] == kEmpty) --growthLeft;
+  ctrl[index] = static_cast<ctrl_type>(slotHash & 0x7F);
+  ++elementCount;
+  return std::pair<iterator, bool>(iterator(this, index), true);
+}
+
+// Rebuilds the table at newCapacity, which also drops every tombstone.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::resize(
+    size_type newCapacity) {
+  ctrl_type *oldCtrl = ctrl;
+  slot_type *oldSlots = slots;
+  size_type oldCapacity = capacity;
+  allocateTable(newCapacity);
+
+  slot_allocator alloc(allocator);
+  for (size_type i = 0; i < oldCapacity; ++i) {
+    if (oldCtrl[i] < 0) continue;
+    size_type slotHash = hashOf(keyOf(oldSlots[i]));
+    size_type index = findFree(slotHash);
+    slot_traits::construct(alloc, slots + index, std::move(oldSlots[i]));
+    slot_traits::destroy(alloc, oldSlots + i);
+    ctrl[index] = static_cast<ctrl_type>(slotHash & 0x7F);
+  }
+  growthLeft -= elementCount;
+
+  if (oldCapacity) {
+    ctrl_allocator ctrlAlloc(allocator);
+    std::allocator_traits<ctrl_allocator>::deallocate(ctrlAlloc, oldCtrl,
+                                                      oldCapacity);
+    slot_traits::deallocate(alloc, oldSlots, oldCapacity);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::allocateTable(
+    size_type newCapacity) {
+  ctrl_allocator ctrlAlloc(allocator);
+  slot_allocator alloc(allocator);
+  ctrl = std::allocator_traits<ctrl_allocator>::allocate(ctrlAlloc,
+                                                         newCapacity);
+  slots = slot_traits::allocate(alloc, newCapacity);
+  std::fill(ctrl, ctrl + newCapacity, kEmpty);
+  capacity = newCapacity;
+  growthLeft = growthFor(newCapacity);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::destroySlots() {
+  slot_allocator alloc(allocator);
+  for (size_type i = 0; i < capacity; ++i)
+    if (ctrl[i] >= 0) slot_traits::destroy(alloc, slots + i);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::releaseTable() {
+  if (capacity) {
+    ctrl_allocator ctrlAlloc(allocator);
+    slot_allocator alloc(allocator);
+    std::allocator_traits<ctrl_allocator>::deallocate(ctrlAlloc, ctrl,
+                                                      capacity);
+    slot_traits::deallocate(alloc, slots, capacity);
+  }
+  ctrl = nullptr;
+  slots = nullptr;
+  capacity = 0;
+  elementCount = 0;
+  growthLeft = 0;
+}
+
+// Expects an empty, unallocated table. The layout is copied as is, so no
+// key is hashed again.
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::copyFrom(
+    const HashTable &other) {
+  if (other.capacity == 0) return;
+
+  allocateTable(other.capacity);
+  slot_allocator alloc(allocator);
+  for (size_type i = 0; i < capacity; ++i) {
+    if (other.ctrl[i] >= 0)
+      slot_traits::construct(alloc, slots + i, other.slots[i]);
+    ctrl[i] = other.ctrl[i];
+    elementCount += other.ctrl[i] >= 0;
+  }
+  growthLeft = other.growthLeft;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void HashTable<Key, T, Hash, KeyEqual, Allocator>::swapTable(
+    HashTable &other) {
+  std::swap(ctrl, other.ctrl);
+  std::swap(slots, other.slots);
+  std::swap(capacity, other.capacity);
+  std::swap(elementCount, other.elementCount);
+  std::swap(growthLeft, other.growthLeft);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef __S21_CONTAINERS_INDEX_MULTISET_H__
+#define __S21_CONTAINERS_INDEX_MULTISET_H__
+
+#include "s21_index_tree.h"
+
+namespace s21 {
+template <class Key, class Allocator = std::allocator<Key>>
+class index_multiset : public IndexTree<Key, void, Allocator, true> {
+ public:
+  // Member type
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename IndexTree<Key, void, Allocator, true>::Iterator;
+  using const_iterator =
+      typename IndexTree<Key, void, Allocator, true>::ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // Member functions
+  index_multiset() : IndexTree<Key, void, Allocator, true>(){};
+  explicit index_multiset(const Allocator& alloc)
+      : IndexTree<Key, void, Allocator, true>(alloc){};
+  index_multiset(std::initializer_list<value_type> const& items,
+                 const Allocator& alloc = Allocator())
+      : index_multiset(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  index_multiset(InputIt first, InputIt last,
+                 const Allocator& alloc = Allocator())
+      : IndexTree<Key, void, Allocator, true>(alloc) {
+    for (; first != last; ++first) insert(*first);
+  };
+  index_multiset(const index_multiset& ms)
+      : IndexTree<Key, void, Allocator, true>(ms){};
+  index_multiset(index_multiset&& ms)
+      : IndexTree<Key, void, Allocator, true>(std::move(ms)){};
+  ~index_multiset() = default;
+  index_multiset& operator=(index_multiset&& ms) {
+    IndexTree<Key, void, Allocator, true>::operator=(std::move(ms));
+    return *this;
+  };
+
+  // Modifiers
+  iterator insert(const value_type& value);
+
+  // Lookup
+  size_type count(const Key& key);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(std::pair(insert(std::forward<Args>(args)), true)), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename Allocator>
+typename index_multiset<Key, Allocator>::iterator
+index_multiset<Key, Allocator>::insert(const value_type& value) {
+  return this->insertSlot(value, value).first;
+}
+
+template <typename Key, typename Allocator>
+typename index_multiset<Key, Allocator>::size_type
+index_multiset<Key, Allocator>::count(const Key& key) {
+  size_type result = 0;
+  iterator last = this->upper_bound(key);
+  for (iterator it = this->lower_bound(key); it != last; ++it) ++result;
+  return result;
+}
+
+}  // namespace s21
+
+#endif
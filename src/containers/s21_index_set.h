@@ -0,0 +1,59 @@
+#ifndef __S21_CONTAINERS_INDEX_SET_H__
+#define __S21_CONTAINERS_INDEX_SET_H__
+
+#include "s21_index_tree.h"
+
+namespace s21 {
+template <typename Key, typename Allocator = std::allocator<Key>>
+class index_set : public IndexTree<Key, void, Allocator, false> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const Key&;
+  using iterator = typename IndexTree<Key, void, Allocator, false>::Iterator;
+  using const_iterator =
+      typename IndexTree<Key, void, Allocator, false>::ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  index_set() : IndexTree<Key, void, Allocator, false>(){};
+  explicit index_set(const Allocator& alloc)
+      : IndexTree<Key, void, Allocator, false>(alloc){};
+  index_set(std::initializer_list<Key> const& items,
+            const Allocator& alloc = Allocator())
+      : index_set(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  index_set(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+      : IndexTree<Key, void, Allocator, false>(alloc) {
+    for (; first != last; ++first) insert(*first);
+  };
+  index_set(const index_set& other)
+      : IndexTree<Key, void, Allocator, false>(other){};
+  index_set(index_set&& other)
+      : IndexTree<Key, void, Allocator, false>(std::move(other)){};
+  ~index_set() = default;
+  index_set& operator=(index_set&& s) {
+    IndexTree<Key, void, Allocator, false>::operator=(std::move(s));
+    return *this;
+  };
+
+  std::pair<iterator, bool> insert(const value_type& value);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename Allocator>
+std::pair<typename index_set<Key, Allocator>::iterator, bool>
+index_set<Key, Allocator>::insert(const value_type& value) {
+  return this->insertSlot(value, value);
+}
+
+}  // namespace s21
+
+#endif
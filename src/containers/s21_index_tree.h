@@ -0,0 +1,685 @@
+#ifndef __S21_CONTAINERS_INDEX_TREE_H__
+#define __S21_CONTAINERS_INDEX_TREE_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_RBTree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Red-black tree whose nodes live in one s21::vector and refer to each other
+// by 32-bit index instead of by pointer. Index 0 is a black sentinel that
+// stands for every missing child and for end(), so the algorithms need no
+// null checks. Erased nodes go on a free list threaded through their left
+// links and are reused by later inserts.
+//
+// Nothing in a node depends on where the array lives: copying the tree is a
+// plain array copy, and the vector may reallocate as it grows. Iterators
+// hold an index and stay valid across inserts; references into elements do
+// not survive growth. Sets pass void for T, multi-variants keep equal keys
+// in insertion order.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+class IndexTree {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using index_type = uint32_t;
+  using slot_type = RBTreeNodeSlot<Key, T>;
+
+  static constexpr index_type kNil = 0;
+
+  enum NodeColor { BLACK, RED };
+
+  // The parent index is shifted left by one to make room for the colour.
+  struct Node : slot_type {
+    index_type left = kNil;
+    index_type right = kNil;
+    index_type parentAndColor = BLACK;
+
+    Node() = default;
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args &&...args)
+        : slot_type(std::in_place, std::forward<Args>(args)...) {}
+  };
+
+  IndexTree();
+  explicit IndexTree(const Allocator &alloc);
+  IndexTree(const IndexTree &other);
+  IndexTree(IndexTree &&other);
+  ~IndexTree() = default;
+  IndexTree &operator=(IndexTree &&other);
+
+  iterator begin();
+  iterator end();
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void clear();
+  void reserve(size_type count);
+  void erase(iterator pos);
+  void swap(IndexTree &other);
+  iterator find(const key_type &key);
+  bool contains(const key_type &key);
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  allocator_type get_allocator();
+
+  class Iterator {
+   public:
+    friend IndexTree<Key, T, Allocator, IsMulti>;
+    IndexTree *tree;
+    index_type index;
+
+    Iterator();
+    Iterator(IndexTree *tree, index_type index);
+
+    iterator &operator++();
+    iterator operator++(int);
+    iterator &operator--();
+    iterator operator--(int);
+    reference operator*();
+    const key_type &key();
+    bool operator==(const iterator &it);
+    bool operator!=(const iterator &it);
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    ConstIterator() : Iterator(){};
+
+    const_reference operator*();
+  };
+
+ protected:
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+  s21::vector<Node, node_allocator> nodes;
+  index_type root;
+  index_type freeHead;
+  size_type elementCount;
+
+  index_type &left(index_type node);
+  index_type &right(index_type node);
+  index_type parent(index_type node);
+  void setParent(index_type node, index_type parent);
+  NodeColor color(index_type node);
+  void setColor(index_type node, NodeColor color);
+  const key_type &keyAt(index_type node);
+
+  void resetStorage();
+  template <typename... Args>
+  index_type allocateNode(Args &&...args);
+  void releaseNode(index_type node);
+  index_type lowerIndex(const key_type &key);
+  index_type upperIndex(const key_type &key);
+  index_type minimum(index_type node);
+  index_type maximum(index_type node);
+  index_type successor(index_type node);
+  index_type predecessor(index_type node);
+  template <typename... Args>
+  std::pair<iterator, bool> insertSlot(const key_type &key, Args &&...args);
+  void rotateLeft(index_type node);
+  void rotateRight(index_type node);
+  void fixInsertion(index_type node);
+  void transplant(index_type node, index_type target);
+  void fixDeletion(index_type node);
+};
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+IndexTree<Key, T, Allocator, IsMulti>::IndexTree() : IndexTree(Allocator()) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+IndexTree<Key, T, Allocator, IsMulti>::IndexTree(const Allocator &alloc)
+    : nodes(node_allocator(alloc)),
+      root(kNil),
+      freeHead(kNil),
+      elementCount(0) {
+  resetStorage();
+}
+
+// Indices mean the same in the copy, so the array is copied as is.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+IndexTree<Key, T, Allocator, IsMulti>::IndexTree(const IndexTree &other)
+    : nodes(other.nodes),
+      root(other.root),
+      freeHead(other.freeHead),
+      elementCount(other.elementCount) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+IndexTree<Key, T, Allocator, IsMulti>::IndexTree(IndexTree &&other)
+    : nodes(std::move(other.nodes)),
+      root(other.root),
+      freeHead(other.freeHead),
+      elementCount(other.elementCount) {
+  other.resetStorage();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+IndexTree<Key, T, Allocator, IsMulti> &
+IndexTree<Key, T, Allocator, IsMulti>::operator=(IndexTree &&other) {
+  if (this != &other) {
+    nodes = std::move(other.nodes);
+    root = other.root;
+    freeHead = other.freeHead;
+    elementCount = other.elementCount;
+    other.resetStorage();
+  }
+  return *this;
+}
+
+/***************************
+ * IndexTree methods (public)
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator
+IndexTree<Key, T, Allocator, IsMulti>::begin() {
+  return Iterator(this, minimum(root));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator
+IndexTree<Key, T, Allocator, IsMulti>::end() {
+  return Iterator(this, kNil);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool IndexTree<Key, T, Allocator, IsMulti>::empty() {
+  return elementCount == 0;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::size_type
+IndexTree<Key, T, Allocator, IsMulti>::size() {
+  return elementCount;
+}
+
+// One bit of every parent link holds the colour, and index 0 is taken.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::size_type
+IndexTree<Key, T, Allocator, IsMulti>::max_size() {
+  return std::min<size_type>(std::numeric_limits<index_type>::max() / 2 - 1,
+                             std::numeric_limits<size_type>::max() /
+                                 sizeof(Node));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::clear() {
+  resetStorage();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::reserve(size_type count) {
+  nodes.reserve(count + 1);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::erase(iterator pos) {
+  index_type node = pos.index;
+  if (node == kNil) return;
+
+  index_type moved = node, child;
+  NodeColor removedColor = color(node);
+  if (left(node) == kNil) {
+    child = right(node);
+    transplant(node, child);
+  } else if (right(node) == kNil) {
+    child = left(node);
+    transplant(node, child);
+  } else {
+    moved = minimum(right(node));
+    removedColor = color(moved);
+    child = right(moved);
+    if (parent(moved) == node) {
+      setParent(child, moved);
+    } else {
+      transplant(moved, child);
+      right(moved) = right(node);
+      setParent(right(moved), moved);
+    }
+    transplant(node, moved);
+    left(moved) = left(node);
+    setParent(left(moved), moved);
+    setColor(moved, color(node));
+  }
+
+  if (removedColor == BLACK) fixDeletion(child);
+  releaseNode(node);
+  --elementCount;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::swap(IndexTree &other) {
+  nodes.swap(other.nodes);
+  std::swap(root, other.root);
+  std::swap(freeHead, other.freeHead);
+  std::swap(elementCount, other.elementCount);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator
+IndexTree<Key, T, Allocator, IsMulti>::find(const key_type &key) {
+  index_type node = lowerIndex(key);
+  if (node != kNil && key < keyAt(node)) node = kNil;
+  return Iterator(this, node);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool IndexTree<Key, T, Allocator, IsMulti>::contains(const key_type &key) {
+  return find(key) != end();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator
+IndexTree<Key, T, Allocator, IsMulti>::lower_bound(const key_type &key) {
+  return Iterator(this, lowerIndex(key));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator
+IndexTree<Key, T, Allocator, IsMulti>::upper_bound(const key_type &key) {
+  return Iterator(this, upperIndex(key));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+std::pair<typename IndexTree<Key, T, Allocator, IsMulti>::iterator,
+          typename IndexTree<Key, T, Allocator, IsMulti>::iterator>
+IndexTree<Key, T, Allocator, IsMulti>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::allocator_type
+IndexTree<Key, T, Allocator, IsMulti>::get_allocator() {
+  return allocator_type(nodes.get_allocator());
+}
+
+/***************************
+ * Iterator
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::Iterator()
+    : tree(nullptr), index(kNil) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::Iterator(IndexTree *tree,
+                                                          index_type index)
+    : tree(tree), index(index) {}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator &
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::operator++() {
+  index = tree->successor(index);
+  return *this;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::operator++(int) {
+  Iterator tmp = *this;
+  operator++();
+  return tmp;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator &
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::operator--() {
+  index = tree->predecessor(index);
+  return *this;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::iterator
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::operator--(int) {
+  Iterator tmp = *this;
+  operator--();
+  return tmp;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::reference
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::operator*() {
+  return tree->nodes[index].value();
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+const typename IndexTree<Key, T, Allocator, IsMulti>::key_type &
+IndexTree<Key, T, Allocator, IsMulti>::Iterator::key() {
+  return tree->keyAt(index);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool IndexTree<Key, T, Allocator, IsMulti>::Iterator::operator==(
+    const iterator &it) {
+  return index == it.index;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+bool IndexTree<Key, T, Allocator, IsMulti>::Iterator::operator!=(
+    const iterator &it) {
+  return index != it.index;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::const_reference
+IndexTree<Key, T, Allocator, IsMulti>::ConstIterator::operator*() {
+  return Iterator::operator*();
+}
+
+/***************************
+ * IndexTree inner methods (protected)
+ * *************************/
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type &
+IndexTree<Key, T, Allocator, IsMulti>::left(index_type node) {
+  return nodes[node].left;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type &
+IndexTree<Key, T, Allocator, IsMulti>::right(index_type node) {
+  return nodes[node].right;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::parent(index_type node) {
+  return nodes[node].parentAndColor >> 1;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::setParent(index_type node,
+                                                      index_type parent) {
+  nodes[node].parentAndColor = parent << 1 | (nodes[node].parentAndColor & 1);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::NodeColor
+IndexTree<Key, T, Allocator, IsMulti>::color(index_type node) {
+  return static_cast<NodeColor>(nodes[node].parentAndColor & 1);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::setColor(index_type node,
+                                                     NodeColor color) {
+  nodes[node].parentAndColor = (nodes[node].parentAndColor & ~1u) | color;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+const typename IndexTree<Key, T, Allocator, IsMulti>::key_type &
+IndexTree<Key, T, Allocator, IsMulti>::keyAt(index_type node) {
+  return nodes[node].key;
+}
+
+// Drops every node and puts the sentinel back at index 0.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::resetStorage() {
+  nodes.clear();
+  nodes.push_back(Node());
+  root = kNil;
+  freeHead = kNil;
+  elementCount = 0;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename... Args>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::allocateNode(Args &&...args) {
+  if (freeHead == kNil) {
+    nodes.push_back(Node(std::in_place, std::forward<Args>(args)...));
+    return static_cast<index_type>(nodes.size() - 1);
+  }
+  index_type node = freeHead;
+  freeHead = left(node);
+  static_cast<slot_type &>(nodes[node]) =
+      slot_type(std::in_place, std::forward<Args>(args)...);
+  left(node) = kNil;
+  return node;
+}
+
+// The slot is reset so that a freed node holds on to no resources.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::releaseNode(index_type node) {
+  static_cast<slot_type &>(nodes[node]) = slot_type();
+  right(node) = kNil;
+  nodes[node].parentAndColor = BLACK;
+  left(node) = freeHead;
+  freeHead = node;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::lowerIndex(const key_type &key) {
+  index_type node = root, result = kNil;
+  while (node != kNil) {
+    if (keyAt(node) < key) {
+      node = right(node);
+    } else {
+      result = node;
+      node = left(node);
+    }
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::upperIndex(const key_type &key) {
+  index_type node = root, result = kNil;
+  while (node != kNil) {
+    if (key < keyAt(node)) {
+      result = node;
+      node = left(node);
+    } else {
+      node = right(node);
+    }
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::minimum(index_type node) {
+  if (node == kNil) return kNil;
+  while (left(node) != kNil) node = left(node);
+  return node;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::maximum(index_type node) {
+  if (node == kNil) return kNil;
+  while (right(node) != kNil) node = right(node);
+  return node;
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::successor(index_type node) {
+  if (node == kNil) return minimum(root);
+  if (right(node) != kNil) return minimum(right(node));
+  index_type up = parent(node);
+  while (up != kNil && node == right(up)) {
+    node = up;
+    up = parent(up);
+  }
+  return up;
+}
+
+// Stepping back from end() gives the largest element.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+typename IndexTree<Key, T, Allocator, IsMulti>::index_type
+IndexTree<Key, T, Allocator, IsMulti>::predecessor(index_type node) {
+  if (node == kNil) return maximum(root);
+  if (left(node) != kNil) return maximum(left(node));
+  index_type up = parent(node);
+  while (up != kNil && node == left(up)) {
+    node = up;
+    up = parent(up);
+  }
+  return up;
+}
+
+// The node is built from args only once the key is known to go in, and key
+// is not used after that, so it may refer into args.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+template <typename... Args>
+std::pair<typename IndexTree<Key, T, Allocator, IsMulti>::iterator, bool>
+IndexTree<Key, T, Allocator, IsMulti>::insertSlot(const key_type &key,
+                                                  Args &&...args) {
+  index_type up = kNil, node = root;
+  bool toLeft = false;
+  while (node != kNil) {
+    up = node;
+    toLeft = key < keyAt(node);
+    if (!IsMulti && !toLeft && !(keyAt(node) < key))
+      return std::pair<iterator, bool>(Iterator(this, node), false);
+    node = toLeft ? left(node) : right(node);
+  }
+
+  if (elementCount >= max_size()) throw std::length_error("IndexTree is full");
+  node = allocateNode(std::forward<Args>(args)...);
+  setParent(node, up);
+  setColor(node, RED);
+  if (up == kNil)
+    root = node;
+  else if (toLeft)
+    left(up) = node;
+  else
+    right(up) = node;
+  ++elementCount;
+  fixInsertion(node);
+  return std::pair<iterator, bool>(Iterator(this, node), true);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::rotateLeft(index_type node) {
+  index_type target = right(node);
+  right(node) = left(target);
+  if (left(target) != kNil) setParent(left(target), node);
+  setParent(target, parent(node));
+  if (parent(node) == kNil)
+    root = target;
+  else if (node == left(parent(node)))
+    left(parent(node)) = target;
+  else
+    right(parent(node)) = target;
+  left(target) = node;
+  setParent(node, target);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::rotateRight(index_type node) {
+  index_type target = left(node);
+  left(node) = right(target);
+  if (right(target) != kNil) setParent(right(target), node);
+  setParent(target, parent(node));
+  if (parent(node) == kNil)
+    root = target;
+  else if (node == right(parent(node)))
+    right(parent(node)) = target;
+  else
+    left(parent(node)) = target;
+  right(target) = node;
+  setParent(node, target);
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::fixInsertion(index_type node) {
+  while (color(parent(node)) == RED) {
+    index_type up = parent(node), grand = parent(up);
+    bool isLeft = up == left(grand);
+    index_type uncle = isLeft ? right(grand) : left(grand);
+    if (color(uncle) == RED) {
+      setColor(up, BLACK);
+      setColor(uncle, BLACK);
+      setColor(grand, RED);
+      node = grand;
+      continue;
+    }
+    if (node == (isLeft ? right(up) : left(up))) {
+      node = up;
+      isLeft ? rotateLeft(node) : rotateRight(node);
+      up = parent(node);
+    }
+    setColor(up, BLACK);
+    setColor(grand, RED);
+    isLeft ? rotateRight(grand) : rotateLeft(grand);
+  }
+  setColor(root, BLACK);
+}
+
+// Puts target where node was. The sentinel's parent is set as well, which
+// fixDeletion relies on when target is the sentinel.
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::transplant(index_type node,
+                                                       index_type target) {
+  if (parent(node) == kNil)
+    root = target;
+  else if (node == left(parent(node)))
+    left(parent(node)) = target;
+  else
+    right(parent(node)) = target;
+  setParent(target, parent(node));
+}
+
+template <typename Key, typename T, typename Allocator, bool IsMulti>
+void IndexTree<Key, T, Allocator, IsMulti>::fixDeletion(index_type node) {
+  while (node != root && color(node) == BLACK) {
+    index_type up = parent(node);
+    bool isLeft = node == left(up);
+    index_type sibling = isLeft ? right(up) : left(up);
+    if (color(sibling) == RED) {
+      setColor(sibling, BLACK);
+      setColor(up, RED);
+      isLeft ? rotateLeft(up) : rotateRight(up);
+      sibling = isLeft ? right(up) : left(up);
+    }
+    index_type nearChild = isLeft ? left(sibling) : right(sibling);
+    index_type farChild = isLeft ? right(sibling) : left(sibling);
+    if (color(nearChild) == BLACK && color(farChild) == BLACK) {
+      setColor(sibling, RED);
+      node = up;
+      continue;
+    }
+    if (color(farChild) == BLACK) {
+      setColor(nearChild, BLACK);
+      setColor(sibling, RED);
+      isLeft ? rotateRight(sibling) : rotateLeft(sibling);
+      sibling = isLeft ? right(up) : left(up);
+      farChild = isLeft ? right(sibling) : left(sibling);
+    }
+    setColor(sibling, color(up));
+    setColor(up, BLACK);
+    setColor(farChild, BLACK);
+    isLeft ? rotateLeft(up) : rotateRight(up);
+    node = root;
+  }
+  setColor(node, BLACK);
+}
+
+}  // namespace s21
+
+#endif
@@ -3,10 +3,11 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <utility>
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   template <typename U>
@@ -22,7 +23,7 @@ class list {
   template <typename U>
   class ListIterator {
    public:
-    using ListNode = typename s21::list<T>::ListNode<U>*;
+    using ListNode = typename list::template ListNode<U>*;
     ListIterator(ListNode node) : current_(node) {}
     T& operator*() { return current_->value_; }
     ListIterator& operator++() {
@@ -45,7 +46,7 @@ class list {
   template <typename U>
   class ListConstIterator {
    public:
-    using ListNode = const typename s21::list<T>::ListNode<T>*;
+    using ListNode = const typename list::template ListNode<T>*;
     ListConstIterator(ListNode node) : current_(node) {}
     const T& operator*() const { return current_->value_; }
     ListConstIterator& operator++() {
@@ -73,70 +74,75 @@ class list {
   using iterator = ListIterator<T>;
   using const_iterator = ListConstIterator<T>;
   using pointer = ListNode<T>*;
+  using allocator_type = Allocator;
 
+ private:
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<ListNode<T>>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+ public:
   // list functions
-  list() : head_(new ListNode<T>(value_type())), end_(head_), size_(0) {}
+  list() : list(Allocator()) {}
+
+  explicit list(const Allocator& alloc)
+      : allocator_(alloc), end_(createNode(value_type())) {
+    head_ = end_;
+  }
 
-  list(size_type n) : end_(new ListNode<T>(value_type())), size_(0) {
+  list(size_type n, const Allocator& alloc = Allocator()) : list(alloc) {
     for (size_type i = 0; i < n; ++i) {
       push_back(value_type());
     }
-    if (n > 0) {
-      tail_->next_ = end_;
-    }
   }
 
-  list(std::initializer_list<value_type> const& items)
-      : end_(new ListNode<T>(value_type())), size_(0) {
+  list(std::initializer_list<value_type> const& items,
+       const Allocator& alloc = Allocator())
+      : list(alloc) {
     for (const auto& item : items) {
       push_back(item);
     }
   }
 
   // copy constructor
-  list(const list& l) : end_(new ListNode<T>(value_type())), size_(0) {
+  list(const list& l)
+      : list(node_traits::select_on_container_copy_construction(l.allocator_)) {
     for (const auto& item : l) {
       push_back(item);
     }
   }
 
   // move constructor
-  list(list&& l) {
-    if (this != &l) {
-      clear();
-      end_ = l.end_;
-      tail_ = l.tail_;
-      head_ = l.head_;
-      size_ = l.size_;
-      l.end_ = nullptr;
-      l.tail_ = nullptr;
-      l.head_ = nullptr;
-      l.size_ = 0;
-    }
-  }
+  list(list&& l) : allocator_(std::move(l.allocator_)) { steal(l); }
+
   // destructor
   ~list() {
     clear();
-    delete end_;
+    if (end_) destroyNode(end_);
   }
 
   list operator=(list&& l) {
     if (this != &l) {
+      constexpr bool propagate =
+          node_traits::propagate_on_container_move_assignment::value;
       clear();
-      if (end_) delete end_;
-      if (head_) delete head_;
-      end_ = l.end_;
-      tail_ = l.tail_;
-      head_ = l.head_;
-      size_ = l.size_;
-      l.end_ = nullptr;
-      l.tail_ = nullptr;
-      l.head_ = nullptr;
-      l.size_ = 0;
+      if constexpr (propagate) {
+        if (end_) destroyNode(end_);
+        allocator_ = std::move(l.allocator_);
+        steal(l);
+      } else if (allocator_ == l.allocator_) {
+        if (end_) destroyNode(end_);
+        steal(l);
+      } else {
+        for (auto& item : l) push_back(std::move(item));
+        l.clear();
+      }
     }
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator_type(allocator_); }
+
   // list element access
   const_reference front() const {
     if (!empty()) {
@@ -173,7 +179,7 @@ class list {
   }
 
   iterator insert(iterator pos, const_reference value) {
-    ListNode<value_type>* newNode = new ListNode<value_type>(value);
+    ListNode<value_type>* newNode = createNode(value);
 
     newNode->previous_ = pos.current_->previous_;
     if (pos.current_->previous_)
@@ -206,7 +212,7 @@ class list {
         tail_ = end_;
     }
 
-    delete pos.current_;
+    destroyNode(pos.current_);
     size_--;
   }
 
@@ -219,6 +225,8 @@ class list {
   void pop_front() { erase(iterator(head_)); }
 
   void swap(list& other) {
+    if constexpr (node_traits::propagate_on_container_swap::value)
+      std::swap(allocator_, other.allocator_);
     pointer temp_head_ = other.head_;
     pointer temp_tail_ = other.tail_;
     pointer temp_end_ = other.end_;
@@ -237,7 +245,7 @@ class list {
     if (!head_ || !other.head_) {
       return;
     }
-    list<value_type> temp;
+    list temp(get_allocator());
     auto current1 = begin();
     auto current2 = other.begin();
     while (current1 != end() && current2 != other.end()) {
@@ -313,24 +321,22 @@ class list {
 
   void sort() {
     if (!(size_ <= 1)) {
-      list* left = new list();
-      list* right = new list();
+      list left(get_allocator());
+      list right(get_allocator());
       auto current = begin();
       for (size_t i = 0; i < size_ / 2; i++) {
-        left->push_back(*current);
+        left.push_back(*current);
         ++current;
       }
       for (size_t i = size_ / 2; i < size_; i++) {
-        right->push_back(*current);
+        right.push_back(*current);
         ++current;
       }
-      left->sort();
-      right->sort();
+      left.sort();
+      right.sort();
       clear();
-      merge(*left);
-      merge(*right);
-      delete left;
-      delete right;
+      merge(left);
+      merge(right);
     }
   }
 
@@ -357,10 +363,33 @@ class list {
   }
 
  private:
+  node_allocator allocator_;
   pointer head_ = nullptr;
   pointer tail_ = nullptr;
   pointer end_ = nullptr;
   size_type size_ = 0;
+
+  pointer createNode(const_reference value) {
+    pointer node = node_traits::allocate(allocator_, 1);
+    node_traits::construct(allocator_, node, value);
+    return node;
+  }
+
+  void destroyNode(pointer node) {
+    node_traits::destroy(allocator_, node);
+    node_traits::deallocate(allocator_, node, 1);
+  }
+
+  void steal(list& l) {
+    end_ = l.end_;
+    tail_ = l.tail_;
+    head_ = l.head_;
+    size_ = l.size_;
+    l.end_ = nullptr;
+    l.tail_ = nullptr;
+    l.head_ = nullptr;
+    l.size_ = 0;
+  }
 };
 };  // namespace s21
 
@@ -4,8 +4,9 @@
 #include "s21_RBTree.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map : public RBTree<Key, T> {
+template <typename Key, typename T,
+          typename Allocator = PoolAllocator<std::pair<const Key, T>>>
+class map : public RBTree<Key, T, Allocator> {
  public:
   // Member types
   using key_type = Key;
@@ -13,16 +14,24 @@ class map : public RBTree<Key, T> {
   using value_type = std::pair<const Key, T>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RBTree<Key, T>::Iterator;
-  using const_iterator = typename RBTree<Key, T>::ConstIterator;
+  using iterator = typename RBTree<Key, T, Allocator>::Iterator;
+  using const_iterator = typename RBTree<Key, T, Allocator>::ConstIterator;
   using size_type = size_t;
-  using Node = typename RBTree<Key, T>::Node;
+  using allocator_type = Allocator;
+  using Node = typename RBTree<Key, T, Allocator>::Node;
+  using node_type = typename RBTree<Key, T, Allocator>::node_type;
+  using insert_return_type =
+      typename RBTree<Key, T, Allocator>::insert_return_type;
 
   // Member functions
-  map() : RBTree<Key, T>(){};
-  map(std::initializer_list<value_type> const &items);
-  map(const map &m) : RBTree<Key, T>(m){};
-  map(map &&m) : RBTree<Key, T>(std::move(m)){};
+  map() : RBTree<Key, T, Allocator>(){};
+  explicit map(const Allocator &alloc) : RBTree<Key, T, Allocator>(alloc){};
+  map(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator());
+  template <typename InputIt>
+  map(InputIt first, InputIt last, const Allocator &alloc = Allocator());
+  map(const map &m) : RBTree<Key, T, Allocator>(m){};
+  map(map &&m) : RBTree<Key, T, Allocator>(std::move(m)){};
   ~map() = default;
   map &operator=(map &&m) = default;
 
@@ -32,8 +41,26 @@ class map : public RBTree<Key, T> {
 
   // Modifiers
   std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
   std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  iterator insert(iterator hint, const value_type &value);
+  iterator insert(iterator hint, value_type &&value);
+  insert_return_type insert(node_type &&nh);
   std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+  template <typename... Args>
+  iterator try_emplace(iterator hint, const Key &key, Args &&...args);
+  template <typename... Args>
+  iterator try_emplace(iterator hint, Key &&key, Args &&...args);
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
 
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
@@ -41,73 +68,174 @@ class map : public RBTree<Key, T> {
     (ret.push_back(insert(std::forward<Args>(args))), ...);
     return ret;
   }
+
+ protected:
+  template <typename InputIt>
+  void assignRange(InputIt first, InputIt last, bool isSorted);
 };
 
-template <typename Key, typename T>
-map<Key, T>::map(std::initializer_list<value_type> const &items) {
-  map();
-  for (auto &item : items) insert(item.first, item.second);
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(std::initializer_list<value_type> const &items,
+                            const Allocator &alloc)
+    : map(items.begin(), items.end(), alloc) {}
+
+template <typename Key, typename T, typename Allocator>
+template <typename InputIt>
+map<Key, T, Allocator>::map(InputIt first, InputIt last,
+                            const Allocator &alloc)
+    : RBTree<Key, T, Allocator>(alloc) {
+  assignRange(first, last, false);
 }
 
-template <typename Key, typename T>
-T &map<Key, T>::operator[](const Key &key) {
-  return RBTree<Key, T>::contains(key) ? *(RBTree<Key, T>::find(key))
-                                       : *(insert(key, mapped_type()).first);
+// One descent either way: the search that misses the key already knows
+// where to attach the new node.
+template <typename Key, typename T, typename Allocator>
+T &map<Key, T, Allocator>::operator[](const Key &key) {
+  return *try_emplace(key).first;
 }
 
-template <typename Key, typename T>
-T &map<Key, T>::at(const Key &key) {
-  if (!RBTree<Key, T>::contains(key))
-    throw std::out_of_range("no such element exists");
-  return *(RBTree<Key, T>::find(key));
+template <typename Key, typename T, typename Allocator>
+T &map<Key, T, Allocator>::at(const Key &key) {
+  Node *node = this->search(this->root, key);
+  if (node == nullptr) throw std::out_of_range("no such element exists");
+  return node->value();
 }
 
-template <typename Key, typename T>
-typename std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const value_type &value) {
-  Node *node = new Node();
-  node->key = value.first;
-  node->value = value.second;
+template <typename Key, typename T, typename Allocator>
+typename std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(const value_type &value) {
+  return this->emplaceUnique(value.first, value.first, value.second);
+}
 
-  std::pair<Node *, bool> inserResult = RBTree<Key, T>::insertNode(node);
-  bool isInserted = inserResult.second;
+template <typename Key, typename T, typename Allocator>
+typename std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(value_type &&value) {
+  return this->emplaceUnique(value.first, value.first,
+                             std::move(value.second));
+}
 
-  iterator it = iterator(inserResult.first);
-  std::pair<iterator, bool> insertResult(it, isInserted);
-  if (!isInserted) delete node;
+template <typename Key, typename T, typename Allocator>
+typename std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(const Key &key, const T &obj) {
+  return this->emplaceUnique(key, key, obj);
+}
 
-  return insertResult;
+// The hint saves the search from the root when the key belongs next to it,
+// so a sorted run inserted at end() costs O(1) plus rebalancing per element.
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::insert(
+    iterator hint, const value_type &value) {
+  return this->emplaceHint(hint.node, value.first, value.first, value.second)
+      .first;
 }
 
-template <typename Key, typename T>
-typename std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const Key &key, const T &obj) {
-  Node *node = new Node();
-  node->key = key;
-  node->value = obj;
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::insert(
+    iterator hint, value_type &&value) {
+  return this
+      ->emplaceHint(hint.node, value.first, value.first,
+                    std::move(value.second))
+      .first;
+}
 
-  std::pair<Node *, bool> inserResult = RBTree<Key, T>::insertNode(node);
-  bool isInserted = inserResult.second;
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::insert_return_type
+map<Key, T, Allocator>::insert(node_type &&nh) {
+  return RBTree<Key, T, Allocator>::insert(std::move(nh));
+}
 
-  iterator it = iterator(inserResult.first);
-  std::pair<iterator, bool> insertResult(it, isInserted);
-  if (!isInserted) delete node;
+template <typename Key, typename T, typename Allocator>
+typename std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert_or_assign(const Key &key, const T &obj) {
+  std::pair<iterator, bool> result = try_emplace(key, obj);
+  if (!result.second) *result.first = obj;
+  return result;
+}
 
-  return insertResult;
+// Two arguments are a key and a mapped value and go through try_emplace, so
+// nothing is built for a key that is already present. Any other form needs
+// the key out of a value_type first, whose mapped part is then moved into
+// the node.
+template <typename Key, typename T, typename Allocator>
+template <typename... Args>
+typename std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::emplace(Args &&...args) {
+  if constexpr (sizeof...(Args) == 2) {
+    return try_emplace(std::forward<Args>(args)...);
+  } else {
+    value_type value(std::forward<Args>(args)...);
+    return this->emplaceUnique(value.first, value.first,
+                               std::move(value.second));
+  }
 }
 
-template <typename Key, typename T>
-typename std::pair<typename map<Key, T>::iterator, bool>
-map<Key, T>::insert_or_assign(const Key &key, const T &obj) {
-  std::pair<iterator, bool> result{nullptr, true};
-  if (RBTree<Key, T>::contains(key)) {
-    RBTree<Key, T>::deleteNode(RBTree<Key, T>::search(this->root, key));
-    result.second = false;
+template <typename Key, typename T, typename Allocator>
+template <typename... Args>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::emplace_hint(
+    iterator hint, Args &&...args) {
+  if constexpr (sizeof...(Args) == 2) {
+    return try_emplace(hint, std::forward<Args>(args)...);
+  } else {
+    value_type value(std::forward<Args>(args)...);
+    return this
+        ->emplaceHint(hint.node, value.first, value.first,
+                      std::move(value.second))
+        .first;
   }
-  result.first = insert(key, obj).first;
-  return result;
+}
+
+// The mapped value is constructed from args only if key is inserted.
+template <typename Key, typename T, typename Allocator>
+template <typename... Args>
+typename std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::try_emplace(const Key &key, Args &&...args) {
+  return this->emplaceUnique(key, key, std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Allocator>
+template <typename... Args>
+typename std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::try_emplace(Key &&key, Args &&...args) {
+  return this->emplaceUnique(key, std::move(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Allocator>
+template <typename... Args>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::try_emplace(
+    iterator hint, const Key &key, Args &&...args) {
+  return this->emplaceHint(hint.node, key, key, std::forward<Args>(args)...)
+      .first;
+}
+
+template <typename Key, typename T, typename Allocator>
+template <typename... Args>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::try_emplace(
+    iterator hint, Key &&key, Args &&...args) {
+  return this
+      ->emplaceHint(hint.node, key, std::move(key),
+                    std::forward<Args>(args)...)
+      .first;
+}
+
+template <typename Key, typename T, typename Allocator>
+template <typename InputIt>
+void map<Key, T, Allocator>::assign_sorted(InputIt first, InputIt last) {
+  assignRange(first, last, true);
+}
+
+template <typename Key, typename T, typename Allocator>
+template <typename InputIt>
+void map<Key, T, Allocator>::assignRange(InputIt first, InputIt last,
+                                         bool isSorted) {
+  this->clear();
+  s21::vector<Node *> nodes;
+  for (; first != last; ++first) {
+    nodes.push_back(
+        this->createNode(std::in_place, first->first, first->second));
+  }
+  this->assignNodes(nodes, isSorted, true);
 }
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
@@ -4,40 +4,55 @@
 #include "s21_RBTree.h"
 
 namespace s21 {
-template <class Key>
-class multiset : public RBTree<Key, Key> {
+template <class Key, class Allocator = PoolAllocator<Key>>
+class multiset : public RBTree<Key, void, Allocator> {
  public:
   // Member type
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename RBTree<Key, Key>::Iterator;
-  using const_iterator = const typename RBTree<Key, Key>::Iterator;
+  using iterator = typename RBTree<Key, void, Allocator>::Iterator;
+  using const_iterator = const typename RBTree<Key, void, Allocator>::Iterator;
   using size_type = size_t;
-  using Node = typename RBTree<Key, Key>::Node;
+  using allocator_type = Allocator;
+  using Node = typename RBTree<Key, void, Allocator>::Node;
+  using node_type = typename RBTree<Key, void, Allocator>::node_type;
 
  public:
   // Member functions
-  multiset() : RBTree<Key, Key>(){};
-  multiset(std::initializer_list<value_type> const& items);
-  multiset(const multiset& ms) : RBTree<Key, Key>(ms){};
-  multiset(multiset&& ms) : RBTree<Key, Key>(std::move(ms)){};
+  multiset() : RBTree<Key, void, Allocator>(){};
+  explicit multiset(const Allocator& alloc)
+      : RBTree<Key, void, Allocator>(alloc){};
+  multiset(std::initializer_list<value_type> const& items,
+           const Allocator& alloc = Allocator());
+  template <typename InputIt>
+  multiset(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+  multiset(const multiset& ms) : RBTree<Key, void, Allocator>(ms){};
+  multiset(multiset&& ms) : RBTree<Key, void, Allocator>(std::move(ms)){};
   ~multiset() = default;
   multiset operator=(multiset&& ms);
 
   // Modifiers
   iterator insert(const value_type& value);
+  iterator insert(value_type&& value);
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  iterator insert(node_type&& nh);
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
 
   // Lookup - просмотр мультисета
   size_type count(const Key& key);
-  std::pair<iterator, iterator> equal_range(const Key& key);
-  iterator lower_bound(const Key& key);
-  iterator upper_bound(const Key& key);
 
   // Additional
   iterator insertNode(Node* node);
+  iterator insertNode(Node* node, iterator hint);
   void merge(multiset& other);
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
 
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
@@ -45,96 +60,145 @@ class multiset : public RBTree<Key, Key> {
     (ret.push_back(std::pair(insert(std::forward<Args>(args)), true)), ...);
     return ret;
   }
+
+ private:
+  // Unique-key algorithms, meaningless with duplicate keys.
+  using RBTree<Key, void, Allocator>::set_union;
+  using RBTree<Key, void, Allocator>::set_intersection;
+  using RBTree<Key, void, Allocator>::set_difference;
 };
 
-template <typename Key>
-multiset<Key>::multiset(std::initializer_list<value_type> const& items) {
-  for (value_type value : items) insert(value);
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : multiset(items.begin(), items.end(), alloc){};
+
+template <typename Key, typename Allocator>
+template <typename InputIt>
+multiset<Key, Allocator>::multiset(InputIt first, InputIt last,
+                                   const Allocator& alloc)
+    : RBTree<Key, void, Allocator>(alloc) {
+  this->assignRange(first, last, false, false);
 };
 
-template <typename Key>
-multiset<Key> multiset<Key>::operator=(multiset&& ms) {
-  RBTree<Key, Key>::operator=(std::move(ms));
+template <typename Key, typename Allocator>
+multiset<Key, Allocator> multiset<Key, Allocator>::operator=(multiset&& ms) {
+  RBTree<Key, void, Allocator>::operator=(std::move(ms));
   return *this;
 };
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::insert(
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::insert(
     const value_type& value) {
-  Node* node = new Node();
-  node->key = value;
-  node->value = value;
+  this->checkRoom();
+  return insertNode(this->createNode(std::in_place, value));
+};
 
-  return insertNode(node);
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::insert(
+    value_type&& value) {
+  this->checkRoom();
+  return insertNode(this->createNode(std::in_place, std::move(value)));
 };
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::count(const Key& key) {
-  auto it = RBTree<Key, Key>::begin();
-  auto end = RBTree<Key, Key>::end();
-  size_type count = 0;
-  while (it != end && *it != key) it++;
-  while (it != end && *it++ == key) count++;
-  return count;
+// Equal keys go in as close before the hint as the order allows.
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::insert(
+    iterator hint, const value_type& value) {
+  this->checkRoom();
+  return insertNode(this->createNode(std::in_place, value), hint);
 };
 
-template <typename Key>
-std::pair<typename multiset<Key>::iterator, typename multiset<Key>::iterator>
-multiset<Key>::equal_range(const Key& key) {
-  return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::insert(
+    iterator hint, value_type&& value) {
+  this->checkRoom();
+  return insertNode(this->createNode(std::in_place, std::move(value)), hint);
 };
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::lower_bound(const Key& key) {
-  auto start = RBTree<Key, Key>::begin();
-  auto end = RBTree<Key, Key>::end();
-  while (start != end && *start != key) start++;
-  return start;
+template <typename Key, typename Allocator>
+template <typename... Args>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::emplace(
+    Args&&... args) {
+  if constexpr (sizeof...(Args) == 1 &&
+                (std::is_same<std::decay_t<Args>, Key>::value && ...)) {
+    return insert(std::forward<Args>(args)...);
+  } else {
+    return insert(Key(std::forward<Args>(args)...));
+  }
 };
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key& key) {
-  auto it = lower_bound(key);
-  auto end = RBTree<Key, Key>::end();
-  while (it != end && *it++ == key) it++;
-  return it;
+template <typename Key, typename Allocator>
+template <typename... Args>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::emplace_hint(iterator hint, Args&&... args) {
+  if constexpr (sizeof...(Args) == 1 &&
+                (std::is_same<std::decay_t<Args>, Key>::value && ...)) {
+    return insert(hint, std::forward<Args>(args)...);
+  } else {
+    return insert(hint, Key(std::forward<Args>(args)...));
+  }
+};
+
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::insert(
+    node_type&& nh) {
+  if (nh.empty()) return this->end();
+  this->checkRoom();
+  return insertNode(this->takeNode(nh));
 };
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::insertNode(Node* node) {
-  Node *parent = nullptr, *root = this->root;
-  node->color = RBTree<Key, Key>::RED;
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::size_type multiset<Key, Allocator>::count(
+    const Key& key) {
+  return this->rankOf(this->upperBound(key)) -
+         this->rankOf(this->lowerBound(key));
+};
+
+// Keys not below the largest one are attached to it without a search.
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::insertNode(Node* node) {
+  return insertNode(node, this->end());
+};
+
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::insertNode(Node* node, iterator hint) {
+  std::pair<Node*, typename RBTree<Key, void, Allocator>::Direction> slot =
+      this->hintedSlot(hint.node, node->key, true);
+  Node* root = slot.first == nullptr ? this->root : nullptr;
 
   while (root != nullptr) {
-    parent = root;
-    if (node->key < root->key)
+    slot.first = root;
+    if (node->key < root->key) {
+      slot.second = RBTree<Key, void, Allocator>::LEFT;
       root = root->left;
-    else
+    } else {
+      slot.second = RBTree<Key, void, Allocator>::RIGHT;
       root = root->right;
+    }
   };
 
-  if (parent == nullptr)
-    this->root = node;
-  else if (node->key < parent->key)
-    parent->left = node;
-  else
-    parent->right = node;
-
-  node->parent = parent;
+  RBTree<Key, void, Allocator>::attachNode(node, slot.first, slot.second);
 
-  RBTree<Key, Key>::fixInsertion(node);
-
-  return node;
+  return iterator(node, &this->header);
 };
 
-template <typename Key>
-void multiset<Key>::merge(multiset& other) {
-  RBTree constTree(other);
-  iterator it = constTree.begin();
-  iterator itEnd = other.end();
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::merge(multiset& other) {
+  if (this == &other) return;
+
+  while (!other.empty()) {
+    this->checkRoom();
+    insertNode(this->adoptNode(other, other.header.left));
+  }
+}
 
-  for (; it != itEnd; ++it) insert(*it);
-  other.clear();
+template <typename Key, typename Allocator>
+template <typename InputIt>
+void multiset<Key, Allocator>::assign_sorted(InputIt first, InputIt last) {
+  this->assignRange(first, last, true, false);
 }
 
 };  // namespace s21
@@ -0,0 +1,298 @@
+#ifndef __S21_CONTAINERS_NODE_POOL_H__
+#define __S21_CONTAINERS_NODE_POOL_H__
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Size-class slab allocator for container nodes. Blocks are carved from
+// slabs that grow geometrically per size class, freed blocks go to a per-class
+// free list and release() returns every slab at once. Not thread-safe: share
+// one pool only between containers used from the same thread.
+class NodePool {
+ public:
+  using size_type = size_t;
+
+  static constexpr size_type kAlignment = alignof(std::max_align_t);
+  static constexpr size_type kClassCount = 16;
+  static constexpr size_type kMaxBlockSize = kAlignment * kClassCount;
+
+  NodePool();
+  NodePool(const NodePool &other) = delete;
+  NodePool(NodePool &&other);
+  ~NodePool();
+  NodePool &operator=(const NodePool &other) = delete;
+  NodePool &operator=(NodePool &&other);
+
+  void *allocate(size_type bytes, size_type alignment = kAlignment);
+  void deallocate(void *ptr, size_type bytes, size_type alignment = kAlignment);
+  void release();
+  void swap(NodePool &other);
+
+  size_type slab_count() const;
+  size_type bytes_reserved() const;
+
+ private:
+  static constexpr size_type kFirstSlabBlocks = 16;
+  static constexpr size_type kMaxSlabBlocks = 4096;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct Slab {
+    Slab *next;
+    size_type bytes;
+  };
+
+  struct SizeClass {
+    FreeBlock *freeList;
+    char *cursor;
+    char *limit;
+    size_type nextSlabBlocks;
+  };
+
+  static constexpr size_type kSlabHeader =
+      (sizeof(Slab) + kAlignment - 1) / kAlignment * kAlignment;
+
+  SizeClass classes_[kClassCount];
+  Slab *slabs_;
+  size_type slabCount_;
+  size_type bytesReserved_;
+
+  static size_type classOf(size_type bytes);
+  static bool isPooled(size_type bytes, size_type alignment);
+  void resetClasses();
+  void grow(size_type index);
+};
+
+inline NodePool::NodePool()
+    : slabs_(nullptr), slabCount_(0), bytesReserved_(0) {
+  resetClasses();
+}
+
+inline NodePool::NodePool(NodePool &&other) : NodePool() { swap(other); }
+
+inline NodePool::~NodePool() { release(); }
+
+inline NodePool &NodePool::operator=(NodePool &&other) {
+  if (this != &other) {
+    release();
+    swap(other);
+  }
+  return *this;
+}
+
+inline void *NodePool::allocate(size_type bytes, size_type alignment) {
+  if (!isPooled(bytes, alignment))
+    return ::operator new(bytes, std::align_val_t(alignment));
+
+  size_type index = classOf(bytes);
+  SizeClass &sizeClass = classes_[index];
+  if (sizeClass.freeList != nullptr) {
+    FreeBlock *block = sizeClass.freeList;
+    sizeClass.freeList = block->next;
+    return block;
+  }
+
+  size_type blockSize = (index + 1) * kAlignment;
+  if (static_cast<size_type>(sizeClass.limit - sizeClass.cursor) < blockSize)
+    grow(index);
+  void *block = sizeClass.cursor;
+  sizeClass.cursor += blockSize;
+  return block;
+}
+
+inline void NodePool::deallocate(void *ptr, size_type bytes,
+                                 size_type alignment) {
+  if (ptr == nullptr) return;
+  if (!isPooled(bytes, alignment)) {
+    ::operator delete(ptr, std::align_val_t(alignment));
+    return;
+  }
+
+  SizeClass &sizeClass = classes_[classOf(bytes)];
+  FreeBlock *block = static_cast<FreeBlock *>(ptr);
+  block->next = sizeClass.freeList;
+  sizeClass.freeList = block;
+}
+
+inline void NodePool::release() {
+  while (slabs_ != nullptr) {
+    Slab *next = slabs_->next;
+    ::operator delete(slabs_);
+    slabs_ = next;
+  }
+  slabCount_ = 0;
+  bytesReserved_ = 0;
+  resetClasses();
+}
+
+inline void NodePool::swap(NodePool &other) {
+  for (size_type i = 0; i < kClassCount; ++i)
+    std::swap(classes_[i], other.classes_[i]);
+  std::swap(slabs_, other.slabs_);
+  std::swap(slabCount_, other.slabCount_);
+  std::swap(bytesReserved_, other.bytesReserved_);
+}
+
+inline NodePool::size_type NodePool::slab_count() const { return slabCount_; }
+
+inline NodePool::size_type NodePool::bytes_reserved() const {
+  return bytesReserved_;
+}
+
+inline NodePool::size_type NodePool::classOf(size_type bytes) {
+  return bytes == 0 ? 0 : (bytes - 1) / kAlignment;
+}
+
+inline bool NodePool::isPooled(size_type bytes, size_type alignment) {
+  return bytes <= kMaxBlockSize && alignment <= kAlignment;
+}
+
+inline void NodePool::resetClasses() {
+  for (size_type i = 0; i < kClassCount; ++i)
+    classes_[i] = SizeClass{nullptr, nullptr, nullptr, kFirstSlabBlocks};
+}
+
+inline void NodePool::grow(size_type index) {
+  SizeClass &sizeClass = classes_[index];
+  size_type blockSize = (index + 1) * kAlignment;
+  size_type bytes = kSlabHeader + sizeClass.nextSlabBlocks * blockSize;
+
+  Slab *slab = static_cast<Slab *>(::operator new(bytes));
+  slab->next = slabs_;
+  slab->bytes = bytes;
+  slabs_ = slab;
+  ++slabCount_;
+  bytesReserved_ += bytes;
+
+  sizeClass.cursor = reinterpret_cast<char *>(slab) + kSlabHeader;
+  sizeClass.limit = reinterpret_cast<char *>(slab) + bytes;
+  if (sizeClass.nextSlabBlocks < kMaxSlabBlocks) sizeClass.nextSlabBlocks *= 2;
+}
+
+// Standard-compatible allocator over a shared NodePool. A default-constructed
+// allocator has no pool until it first allocates or is copied, so a container
+// that never allocates costs nothing. Copies and rebinds share the pool,
+// creating it first if need be, and a copied container starts with a pool of
+// its own. Moving an allocator shares its pool without creating one, so a
+// moved-from container can still allocate from the pool it had. Containers
+// share an arena only when given the same pool explicitly.
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind {
+    using other = PoolAllocator<U>;
+  };
+
+  PoolAllocator() = default;
+  PoolAllocator(std::shared_ptr<NodePool> pool) : pool_(std::move(pool)) {}
+  PoolAllocator(const PoolAllocator &other) : pool_(other.sharedPool()) {}
+  PoolAllocator(PoolAllocator &&other) : pool_(other.pool_) {}
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &other) : pool_(other.sharedPool()) {}
+  template <typename U>
+  PoolAllocator(PoolAllocator<U> &&other) : pool_(other.pool_) {}
+
+  PoolAllocator &operator=(const PoolAllocator &other);
+  PoolAllocator &operator=(PoolAllocator &&other);
+
+  T *allocate(size_type n);
+  void deallocate(T *ptr, size_type n);
+  PoolAllocator select_on_container_copy_construction() const;
+
+  std::shared_ptr<NodePool> pool();
+  bool release_if_unique();
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U> &other) const {
+    return pool_ == other.pool_;
+  }
+  template <typename U>
+  bool operator!=(const PoolAllocator<U> &other) const {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <typename U>
+  friend class PoolAllocator;
+
+  // Mutable so that copying an allocator without a pool can create the one
+  // both copies then share.
+  mutable std::shared_ptr<NodePool> pool_;
+
+  const std::shared_ptr<NodePool> &sharedPool() const;
+};
+
+template <typename T>
+PoolAllocator<T> &PoolAllocator<T>::operator=(const PoolAllocator &other) {
+  pool_ = other.sharedPool();
+  return *this;
+}
+
+template <typename T>
+PoolAllocator<T> &PoolAllocator<T>::operator=(PoolAllocator &&other) {
+  pool_ = other.pool_;
+  return *this;
+}
+
+template <typename T>
+T *PoolAllocator<T>::allocate(size_type n) {
+  return static_cast<T *>(sharedPool()->allocate(n * sizeof(T), alignof(T)));
+}
+
+template <typename T>
+void PoolAllocator<T>::deallocate(T *ptr, size_type n) {
+  pool_->deallocate(ptr, n * sizeof(T), alignof(T));
+}
+
+template <typename T>
+PoolAllocator<T> PoolAllocator<T>::select_on_container_copy_construction()
+    const {
+  return PoolAllocator();
+}
+
+template <typename T>
+std::shared_ptr<NodePool> PoolAllocator<T>::pool() {
+  return sharedPool();
+}
+
+template <typename T>
+bool PoolAllocator<T>::release_if_unique() {
+  if (pool_.use_count() != 1) return false;
+  pool_->release();
+  return true;
+}
+
+template <typename T>
+const std::shared_ptr<NodePool> &PoolAllocator<T>::sharedPool() const {
+  if (pool_ == nullptr) pool_ = std::make_shared<NodePool>();
+  return pool_;
+}
+
+// Drops every block of an allocator's arena at once when nothing else shares
+// it. Allocators without an arena report false and must free node by node.
+template <typename Allocator>
+bool release_if_unique(Allocator &) {
+  return false;
+}
+
+template <typename T>
+bool release_if_unique(PoolAllocator<T> &allocator) {
+  return allocator.release_if_unique();
+}
+}  // namespace s21
+
+#endif
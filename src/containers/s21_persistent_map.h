@@ -0,0 +1,81 @@
+#ifndef __S21_CONTAINERS_PERSISTENT_MAP_H__
+#define __S21_CONTAINERS_PERSISTENT_MAP_H__
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "s21_persistent_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Copies, and snapshot(), are O(1) and unaffected by later changes to the
+// original. Elements are shared between versions, so there is no
+// operator[] and at() returns a const reference: an update goes through
+// insert_or_assign, which copies the path to the key.
+template <typename Key, typename T>
+class persistent_map : public PersistentTree<Key, T> {
+ public:
+  // Member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename PersistentTree<Key, T>::Iterator;
+  using const_iterator = typename PersistentTree<Key, T>::Iterator;
+  using size_type = size_t;
+
+  // Member functions
+  persistent_map() : PersistentTree<Key, T>(){};
+  persistent_map(std::initializer_list<value_type> const &items)
+      : PersistentTree<Key, T>() {
+    for (const_reference item : items) insert(item);
+  };
+  ~persistent_map() = default;
+
+  persistent_map snapshot() const { return *this; }
+
+  // Element access
+  const T &at(const Key &key) const;
+
+  // Modifiers
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename T>
+const T &persistent_map<Key, T>::at(const Key &key) const {
+  iterator it = this->find(key);
+  if (it == this->end()) throw std::out_of_range("no such element exists");
+  return *it;
+}
+
+template <typename Key, typename T>
+std::pair<typename persistent_map<Key, T>::iterator, bool>
+persistent_map<Key, T>::insert(const value_type &value) {
+  return this->insertSlot(value, false);
+}
+
+template <typename Key, typename T>
+std::pair<typename persistent_map<Key, T>::iterator, bool>
+persistent_map<Key, T>::insert(const Key &key, const T &obj) {
+  return this->insertSlot(value_type(key, obj), false);
+}
+
+template <typename Key, typename T>
+std::pair<typename persistent_map<Key, T>::iterator, bool>
+persistent_map<Key, T>::insert_or_assign(const Key &key, const T &obj) {
+  return this->insertSlot(value_type(key, obj), true);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef __S21_CONTAINERS_PERSISTENT_SET_H__
+#define __S21_CONTAINERS_PERSISTENT_SET_H__
+
+#include <initializer_list>
+
+#include "s21_persistent_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+template <typename Key>
+class persistent_set : public PersistentTree<Key, void> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const Key&;
+  using iterator = typename PersistentTree<Key, void>::Iterator;
+  using const_iterator = typename PersistentTree<Key, void>::Iterator;
+  using size_type = size_t;
+
+  persistent_set() : PersistentTree<Key, void>(){};
+  persistent_set(std::initializer_list<Key> const& items)
+      : PersistentTree<Key, void>() {
+    for (const_reference item : items) insert(item);
+  };
+  ~persistent_set() = default;
+
+  // O(1): the result shares every node with this set.
+  persistent_set snapshot() const { return *this; }
+
+  std::pair<iterator, bool> insert(const value_type& value);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key>
+std::pair<typename persistent_set<Key>::iterator, bool>
+persistent_set<Key>::insert(const value_type& value) {
+  return this->insertSlot(value, false);
+}
+
+}  // namespace s21
+
+#endif
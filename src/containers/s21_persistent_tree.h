@@ -0,0 +1,578 @@
+#ifndef __S21_CONTAINERS_PERSISTENT_TREE_H__
+#define __S21_CONTAINERS_PERSISTENT_TREE_H__
+
+#include <atomic>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Red-black tree with immutable, reference-counted nodes. An update copies
+// only the O(log n) nodes on the path to the changed key and shares every
+// other subtree with the previous version, so copying the tree is O(1): both
+// copies point at the same root and diverge as either is modified. Insertion
+// follows Okasaki, deletion Kahrs.
+//
+// Nodes are never written after construction and their counts are atomic,
+// so versions may be read and destroyed on different threads. A single
+// tree object is not synchronized: take the copy on the writing thread (or
+// under its lock) and hand it to the reader.
+template <typename Key, typename T>
+class PersistentTree {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using size_type = size_t;
+
+  PersistentTree();
+  PersistentTree(const PersistentTree &other);
+  PersistentTree(PersistentTree &&other) noexcept;
+  ~PersistentTree() = default;
+  PersistentTree &operator=(const PersistentTree &other);
+  PersistentTree &operator=(PersistentTree &&other) noexcept;
+
+  iterator begin() const;
+  iterator end() const;
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void clear();
+  void swap(PersistentTree &other);
+  size_type erase(const key_type &key);
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+
+ protected:
+  enum NodeColor { BLACK, RED };
+  using slot_type =
+      std::conditional_t<std::is_void<T>::value, Key, std::pair<const Key, T>>;
+
+  struct Node;
+
+  // Owning pointer to a node: copies share it, the last one frees it.
+  class NodeRef {
+   public:
+    NodeRef() : node(nullptr) {}
+    explicit NodeRef(Node *adopted) : node(adopted) {}
+    NodeRef(const NodeRef &other);
+    NodeRef(NodeRef &&other) noexcept : node(other.node) {
+      other.node = nullptr;
+    }
+    ~NodeRef();
+    NodeRef &operator=(NodeRef other) noexcept;
+
+    Node *get() const { return node; }
+    Node *operator->() const { return node; }
+    explicit operator bool() const { return node != nullptr; }
+
+   private:
+    Node *node;
+  };
+
+  struct Node {
+    std::atomic<size_type> refs;
+    NodeColor color;
+    NodeRef left;
+    NodeRef right;
+    slot_type slot;
+
+    Node(NodeColor color, NodeRef left, NodeRef right, const slot_type &slot);
+    const key_type &key() const;
+    const_reference value() const;
+  };
+
+ public:
+  // Keeps the path from the root as a stack of the nodes still to be
+  // visited, since nodes are shared between versions and cannot point back
+  // to a parent. Valid as long as the tree it came from, or any copy of it
+  // taken before the iterator, is alive.
+  class Iterator {
+   public:
+    friend PersistentTree<Key, T>;
+
+    Iterator();
+
+    iterator &operator++();
+    iterator operator++(int);
+    const_reference operator*() const;
+    const key_type &key() const;
+    bool operator==(const iterator &it) const;
+    bool operator!=(const iterator &it) const;
+
+   protected:
+    s21::vector<const Node *> path;
+    const Node *node;
+
+    void descendLeft(const Node *from);
+  };
+
+ protected:
+  NodeRef root;
+  size_type elementCount;
+
+  std::pair<iterator, bool> insertSlot(const slot_type &slot, bool assign);
+
+  static const key_type &keyOf(const slot_type &slot);
+  static bool isRed(const NodeRef &node);
+  static bool isBlack(const NodeRef &node);
+  static NodeRef makeNode(NodeColor color, NodeRef left,
+                          const slot_type &slot, NodeRef right);
+  static NodeRef paint(const NodeRef &node, NodeColor color);
+  static NodeRef balance(NodeRef left, const slot_type &slot, NodeRef right);
+  static NodeRef balanceLeft(NodeRef left, const slot_type &slot,
+                             NodeRef right);
+  static NodeRef balanceRight(NodeRef left, const slot_type &slot,
+                              NodeRef right);
+  static NodeRef join(const NodeRef &left, const NodeRef &right);
+  static NodeRef insertInto(const NodeRef &node, const slot_type &slot,
+                            bool assign, bool &inserted);
+  static NodeRef eraseFrom(const NodeRef &node, const key_type &key,
+                           bool &erased);
+};
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename T>
+PersistentTree<Key, T>::PersistentTree() : root(), elementCount(0) {}
+
+template <typename Key, typename T>
+PersistentTree<Key, T>::PersistentTree(const PersistentTree &other)
+    : root(other.root), elementCount(other.elementCount) {}
+
+template <typename Key, typename T>
+PersistentTree<Key, T>::PersistentTree(PersistentTree &&other) noexcept
+    : root(std::move(other.root)), elementCount(other.elementCount) {
+  other.elementCount = 0;
+}
+
+template <typename Key, typename T>
+PersistentTree<Key, T> &PersistentTree<Key, T>::operator=(
+    const PersistentTree &other) {
+  root = other.root;
+  elementCount = other.elementCount;
+  return *this;
+}
+
+template <typename Key, typename T>
+PersistentTree<Key, T> &PersistentTree<Key, T>::operator=(
+    PersistentTree &&other) noexcept {
+  root = std::move(other.root);
+  elementCount = other.elementCount;
+  other.elementCount = 0;
+  return *this;
+}
+
+/***************************
+ * NodeRef and Node
+ * *************************/
+
+template <typename Key, typename T>
+PersistentTree<Key, T>::NodeRef::NodeRef(const NodeRef &other)
+    : node(other.node) {
+  if (node != nullptr) node->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Children are released by the node's own destructor, so freeing a version
+// walks only the nodes no other version shares.
+template <typename Key, typename T>
+PersistentTree<Key, T>::NodeRef::~NodeRef() {
+  if (node != nullptr &&
+      node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    delete node;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef &
+PersistentTree<Key, T>::NodeRef::operator=(NodeRef other) noexcept {
+  std::swap(node, other.node);
+  return *this;
+}
+
+template <typename Key, typename T>
+PersistentTree<Key, T>::Node::Node(NodeColor color, NodeRef left,
+                                   NodeRef right, const slot_type &slot)
+    : refs(1),
+      color(color),
+      left(std::move(left)),
+      right(std::move(right)),
+      slot(slot) {}
+
+template <typename Key, typename T>
+const typename PersistentTree<Key, T>::key_type &
+PersistentTree<Key, T>::Node::key() const {
+  return keyOf(slot);
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::const_reference
+PersistentTree<Key, T>::Node::value() const {
+  if constexpr (std::is_void<T>::value)
+    return slot;
+  else
+    return slot.second;
+}
+
+/***************************
+ * Iterator
+ * *************************/
+
+template <typename Key, typename T>
+PersistentTree<Key, T>::Iterator::Iterator() : path(), node(nullptr) {}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator &
+PersistentTree<Key, T>::Iterator::operator++() {
+  path.pop_back();
+  descendLeft(node->right.get());
+  node = path.size() == 0 ? nullptr : path.back();
+  return *this;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator
+PersistentTree<Key, T>::Iterator::operator++(int) {
+  iterator tmp = *this;
+  ++*this;
+  return tmp;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::const_reference
+PersistentTree<Key, T>::Iterator::operator*() const {
+  return node->value();
+}
+
+template <typename Key, typename T>
+const typename PersistentTree<Key, T>::key_type &
+PersistentTree<Key, T>::Iterator::key() const {
+  return node->key();
+}
+
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::Iterator::operator==(const iterator &it) const {
+  return node == it.node;
+}
+
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::Iterator::operator!=(const iterator &it) const {
+  return node != it.node;
+}
+
+template <typename Key, typename T>
+void PersistentTree<Key, T>::Iterator::descendLeft(const Node *from) {
+  for (; from != nullptr; from = from->left.get()) path.push_back(from);
+}
+
+/***************************
+ * PersistentTree methods (public)
+ * *************************/
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::begin()
+    const {
+  iterator it;
+  it.descendLeft(root.get());
+  if (root) it.node = it.path.back();
+  return it;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::end() const {
+  return iterator();
+}
+
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::empty() const {
+  return elementCount == 0;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::size_type PersistentTree<Key, T>::size()
+    const {
+  return elementCount;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::size_type PersistentTree<Key, T>::max_size()
+    const {
+  return std::numeric_limits<size_type>::max() / sizeof(Node);
+}
+
+// Only drops this version's reference: nodes still shared with other
+// copies stay alive.
+template <typename Key, typename T>
+void PersistentTree<Key, T>::clear() {
+  root = NodeRef();
+  elementCount = 0;
+}
+
+template <typename Key, typename T>
+void PersistentTree<Key, T>::swap(PersistentTree &other) {
+  std::swap(root, other.root);
+  std::swap(elementCount, other.elementCount);
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::size_type PersistentTree<Key, T>::erase(
+    const key_type &key) {
+  bool erased = false;
+  NodeRef result = eraseFrom(root, key, erased);
+  if (!erased) return 0;
+  root = paint(result, BLACK);
+  --elementCount;
+  return 1;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::find(
+    const key_type &key) const {
+  iterator it = lower_bound(key);
+  if (it.node != nullptr && key < it.node->key()) return end();
+  return it;
+}
+
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::contains(const key_type &key) const {
+  const Node *node = root.get();
+  while (node != nullptr) {
+    if (key < node->key())
+      node = node->left.get();
+    else if (node->key() < key)
+      node = node->right.get();
+    else
+      return true;
+  }
+  return false;
+}
+
+// The stack keeps exactly the nodes where the search turned left: those are
+// the ones still ahead of the result in key order.
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::lower_bound(
+    const key_type &key) const {
+  iterator it;
+  for (const Node *node = root.get(); node != nullptr;) {
+    if (node->key() < key) {
+      node = node->right.get();
+    } else {
+      it.path.push_back(node);
+      node = node->left.get();
+    }
+  }
+  if (it.path.size() != 0) it.node = it.path.back();
+  return it;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::upper_bound(
+    const key_type &key) const {
+  iterator it;
+  for (const Node *node = root.get(); node != nullptr;) {
+    if (key < node->key()) {
+      it.path.push_back(node);
+      node = node->left.get();
+    } else {
+      node = node->right.get();
+    }
+  }
+  if (it.path.size() != 0) it.node = it.path.back();
+  return it;
+}
+
+/***************************
+ * PersistentTree inner methods (protected)
+ * *************************/
+
+template <typename Key, typename T>
+std::pair<typename PersistentTree<Key, T>::iterator, bool>
+PersistentTree<Key, T>::insertSlot(const slot_type &slot, bool assign) {
+  bool inserted = false;
+  NodeRef result = insertInto(root, slot, assign, inserted);
+  if (result.get() != root.get()) root = paint(result, BLACK);
+  if (inserted) ++elementCount;
+  return {find(keyOf(slot)), inserted};
+}
+
+template <typename Key, typename T>
+const typename PersistentTree<Key, T>::key_type &
+PersistentTree<Key, T>::keyOf(const slot_type &slot) {
+  if constexpr (std::is_void<T>::value)
+    return slot;
+  else
+    return slot.first;
+}
+
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::isRed(const NodeRef &node) {
+  return node && node->color == RED;
+}
+
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::isBlack(const NodeRef &node) {
+  return node && node->color == BLACK;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::makeNode(
+    NodeColor color, NodeRef left, const slot_type &slot, NodeRef right) {
+  return NodeRef(new Node(color, std::move(left), std::move(right), slot));
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::paint(
+    const NodeRef &node, NodeColor color) {
+  if (!node || node->color == color) return node;
+  return makeNode(color, node->left, node->slot, node->right);
+}
+
+// Builds a black node over left, slot and right, first resolving a red node
+// with a red child on either side into a red node with two black children.
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::balance(
+    NodeRef left, const slot_type &slot, NodeRef right) {
+  if (isRed(left) && isRed(right))
+    return makeNode(RED, paint(left, BLACK), slot, paint(right, BLACK));
+  if (isRed(left) && isRed(left->left))
+    return makeNode(RED, paint(left->left, BLACK), left->slot,
+                    makeNode(BLACK, left->right, slot, std::move(right)));
+  if (isRed(left) && isRed(left->right))
+    return makeNode(
+        RED, makeNode(BLACK, left->left, left->slot, left->right->left),
+        left->right->slot,
+        makeNode(BLACK, left->right->right, slot, std::move(right)));
+  if (isRed(right) && isRed(right->right))
+    return makeNode(RED, makeNode(BLACK, std::move(left), slot, right->left),
+                    right->slot, paint(right->right, BLACK));
+  if (isRed(right) && isRed(right->left))
+    return makeNode(
+        RED, makeNode(BLACK, std::move(left), slot, right->left->left),
+        right->left->slot,
+        makeNode(BLACK, right->left->right, right->slot, right->right));
+  return makeNode(BLACK, std::move(left), slot, std::move(right));
+}
+
+// Rebuilds a node whose left subtree has just lost one level of black
+// height.
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::balanceLeft(
+    NodeRef left, const slot_type &slot, NodeRef right) {
+  if (isRed(left))
+    return makeNode(RED, paint(left, BLACK), slot, std::move(right));
+  if (isBlack(right))
+    return balance(std::move(left), slot, paint(right, RED));
+  return makeNode(
+      RED, makeNode(BLACK, std::move(left), slot, right->left->left),
+      right->left->slot,
+      balance(right->left->right, right->slot, paint(right->right, RED)));
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::balanceRight(
+    NodeRef left, const slot_type &slot, NodeRef right) {
+  if (isRed(right))
+    return makeNode(RED, std::move(left), slot, paint(right, BLACK));
+  if (isBlack(left))
+    return balance(paint(left, RED), slot, std::move(right));
+  return makeNode(
+      RED, balance(paint(left->left, RED), left->slot, left->right->left),
+      left->right->slot,
+      makeNode(BLACK, left->right->right, slot, std::move(right)));
+}
+
+// Merges two subtrees of equal black height whose keys are all ordered
+// left before right, as left when their common parent is removed.
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::join(
+    const NodeRef &left, const NodeRef &right) {
+  if (!left) return right;
+  if (!right) return left;
+  if (isRed(left) && isRed(right)) {
+    NodeRef inner = join(left->right, right->left);
+    if (isRed(inner))
+      return makeNode(
+          RED, makeNode(RED, left->left, left->slot, inner->left),
+          inner->slot,
+          makeNode(RED, inner->right, right->slot, right->right));
+    return makeNode(
+        RED, left->left, left->slot,
+        makeNode(RED, std::move(inner), right->slot, right->right));
+  }
+  if (isBlack(left) && isBlack(right)) {
+    NodeRef inner = join(left->right, right->left);
+    if (isRed(inner))
+      return makeNode(
+          RED, makeNode(BLACK, left->left, left->slot, inner->left),
+          inner->slot,
+          makeNode(BLACK, inner->right, right->slot, right->right));
+    return balanceLeft(
+        left->left, left->slot,
+        makeNode(BLACK, std::move(inner), right->slot, right->right));
+  }
+  if (isRed(right))
+    return makeNode(RED, join(left, right->left), right->slot, right->right);
+  return makeNode(RED, left->left, left->slot, join(left->right, right));
+}
+
+// Returns node itself when nothing changed below it, so an insert of an
+// existing key allocates nothing and the versions keep sharing the path.
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::insertInto(
+    const NodeRef &node, const slot_type &slot, bool assign, bool &inserted) {
+  if (!node) {
+    inserted = true;
+    return makeNode(RED, NodeRef(), slot, NodeRef());
+  }
+  if (keyOf(slot) < node->key()) {
+    NodeRef left = insertInto(node->left, slot, assign, inserted);
+    if (left.get() == node->left.get()) return node;
+    if (node->color == BLACK)
+      return balance(std::move(left), node->slot, node->right);
+    return makeNode(RED, std::move(left), node->slot, node->right);
+  }
+  if (node->key() < keyOf(slot)) {
+    NodeRef right = insertInto(node->right, slot, assign, inserted);
+    if (right.get() == node->right.get()) return node;
+    if (node->color == BLACK)
+      return balance(node->left, node->slot, std::move(right));
+    return makeNode(RED, node->left, node->slot, std::move(right));
+  }
+  if (!assign) return node;
+  return makeNode(node->color, node->left, slot, node->right);
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::NodeRef PersistentTree<Key, T>::eraseFrom(
+    const NodeRef &node, const key_type &key, bool &erased) {
+  if (!node) return node;
+  if (key < node->key()) {
+    NodeRef left = eraseFrom(node->left, key, erased);
+    if (!erased) return node;
+    if (isBlack(node->left))
+      return balanceLeft(std::move(left), node->slot, node->right);
+    return makeNode(RED, std::move(left), node->slot, node->right);
+  }
+  if (node->key() < key) {
+    NodeRef right = eraseFrom(node->right, key, erased);
+    if (!erased) return node;
+    if (isBlack(node->right))
+      return balanceRight(node->left, node->slot, std::move(right));
+    return makeNode(RED, node->left, node->slot, std::move(right));
+  }
+  erased = true;
+  return join(node->left, node->right);
+}
+
+}  // namespace s21
+
+#endif
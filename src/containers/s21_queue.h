@@ -13,12 +13,17 @@ class queue {
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using allocator_type = typename ConteinerList::allocator_type;
 
  public:
   // Queue Member functions
   queue() : data_() {}
 
-  queue(std::initializer_list<value_type> const &items) : data_(items) {}
+  explicit queue(const allocator_type &alloc) : data_(alloc) {}
+
+  queue(std::initializer_list<value_type> const &items,
+        const allocator_type &alloc = allocator_type())
+      : data_(items, alloc) {}
 
   queue(const queue &q) : data_(q.data_) {}
 
@@ -4,43 +4,110 @@
 #include "s21_RBTree.h"
 
 namespace s21 {
-template <typename Key>
-class set : public RBTree<Key, Key> {
+template <typename Key, typename Allocator = PoolAllocator<Key>>
+class set : public RBTree<Key, void, Allocator> {
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const Key&;
-  using iterator = typename RBTree<Key, Key>::Iterator;
-  using const_iterator = typename RBTree<Key, Key>::ConstIterator;
+  using iterator = typename RBTree<Key, void, Allocator>::Iterator;
+  using const_iterator = typename RBTree<Key, void, Allocator>::ConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
+  using Node = typename RBTree<Key, void, Allocator>::Node;
+  using node_type = typename RBTree<Key, void, Allocator>::node_type;
+  using insert_return_type =
+      typename RBTree<Key, void, Allocator>::insert_return_type;
 
-  set() : RBTree<Key, Key>(){};
-  set(std::initializer_list<Key> const& items) {
-    for (value_type value : items) RBTree<Key, Key>::insert(value);
+  set() : RBTree<Key, void, Allocator>(){};
+  explicit set(const Allocator& alloc)
+      : RBTree<Key, void, Allocator>(alloc){};
+  set(std::initializer_list<Key> const& items,
+      const Allocator& alloc = Allocator())
+      : set(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  set(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+      : RBTree<Key, void, Allocator>(alloc) {
+    this->assignRange(first, last, false, true);
   };
-  set(const set& other) : RBTree<Key, Key>(other){};
-  set(set&& other) : RBTree<Key, Key>(std::move(other)){};
+  set(const set& other) : RBTree<Key, void, Allocator>(other){};
+  set(set&& other) : RBTree<Key, void, Allocator>(std::move(other)){};
   ~set() = default;
   set& operator=(set&& s) {
-    RBTree<Key, Key>::operator=(std::move(s));
+    RBTree<Key, void, Allocator>::operator=(std::move(s));
     return *this;
   };
 
+  using RBTree<Key, void, Allocator>::insert;
+  std::pair<iterator, bool> insert(value_type&& value);
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
   iterator find(const key_type& key);
 
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     s21::vector<std::pair<iterator, bool>> ret;
-    (ret.push_back(s21::RBTree<int, int>::insert(std::forward<Args>(args))),
+    (ret.push_back(
+         RBTree<Key, void, Allocator>::insert(std::forward<Args>(args))),
      ...);
     return ret;
   }
 };
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::find(const Key& key) {
-  return RBTree<Key, Key>::find(key);
+template <typename Key, typename Allocator>
+std::pair<typename set<Key, Allocator>::iterator, bool>
+set<Key, Allocator>::insert(value_type&& value) {
+  return this->emplaceUnique(value, std::move(value));
+}
+
+// The hint saves the search from the root when the key belongs next to it.
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::iterator set<Key, Allocator>::insert(
+    iterator hint, const value_type& value) {
+  return this->emplaceHint(hint.node, value, value).first;
+}
+
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::iterator set<Key, Allocator>::insert(
+    iterator hint, value_type&& value) {
+  return this->emplaceHint(hint.node, value, std::move(value)).first;
+}
+
+// A single key is searched for as is; other arguments have to be turned
+// into a key before the search.
+template <typename Key, typename Allocator>
+template <typename... Args>
+std::pair<typename set<Key, Allocator>::iterator, bool>
+set<Key, Allocator>::emplace(Args&&... args) {
+  if constexpr (sizeof...(Args) == 1 &&
+                (std::is_same<std::decay_t<Args>, Key>::value && ...)) {
+    return insert(std::forward<Args>(args)...);
+  } else {
+    return insert(Key(std::forward<Args>(args)...));
+  }
+}
+
+template <typename Key, typename Allocator>
+template <typename... Args>
+typename set<Key, Allocator>::iterator set<Key, Allocator>::emplace_hint(
+    iterator hint, Args&&... args) {
+  if constexpr (sizeof...(Args) == 1 &&
+                (std::is_same<std::decay_t<Args>, Key>::value && ...)) {
+    return insert(hint, std::forward<Args>(args)...);
+  } else {
+    return insert(hint, Key(std::forward<Args>(args)...));
+  }
+}
+
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::iterator set<Key, Allocator>::find(
+    const Key& key) {
+  return RBTree<Key, void, Allocator>::find(key);
 }
 
 }  // namespace s21
@@ -0,0 +1,518 @@
+#ifndef __S21_CONTAINERS_SKIP_LIST_H__
+#define __S21_CONTAINERS_SKIP_LIST_H__
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+template <typename T>
+struct SkipListNodeValue {
+  std::atomic<T *> value{nullptr};
+};
+
+template <>
+struct SkipListNodeValue<void> {};
+
+// Lock-free skip list in the style of Fraser and Herlihy-Shavit. A node is
+// removed by setting the low bit of its next pointers, top level first, and
+// whoever marks level 0 owns the removal. Any traversal that passes a marked
+// node unlinks it. Nodes, and mapped values replaced by assign, go to the
+// EpochDomain and are freed only once no pinned thread can reach them, so
+// every operation runs pinned and iterators stay pinned while they live.
+template <typename Key, typename T>
+class SkipList {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using size_type = size_t;
+
+  static constexpr int kMaxHeight = 24;
+
+  // The key lives in raw storage so that the head node needs none, and the
+  // next pointers of every level follow the node in the same allocation.
+  // owners starts at 2: the inserting thread and the removing one each drop
+  // a share once they no longer link it, and the last one retires the node.
+  // The alignment keeps the trailing atomics aligned whatever the key is.
+  struct alignas(std::atomic<uintptr_t>) Node : SkipListNodeValue<T> {
+    std::atomic<int> owners{2};
+    int height = 0;
+    alignas(Key) unsigned char storage[sizeof(Key)];
+
+    const Key &key() const {
+      return *std::launder(reinterpret_cast<const Key *>(storage));
+    }
+    std::atomic<uintptr_t> &link(int level) {
+      return reinterpret_cast<std::atomic<uintptr_t> *>(this + 1)[level];
+    }
+  };
+
+  SkipList();
+  SkipList(const SkipList &) = delete;
+  ~SkipList();
+  SkipList &operator=(const SkipList &) = delete;
+
+  iterator begin() const;
+  iterator end() const;
+  bool empty() const;
+  size_type size() const;
+  void clear();
+  bool erase(const key_type &key);
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+
+  // Holds an epoch guard, so the node it points to, and the value read
+  // through it, stay allocated even if they are removed meanwhile. The guard
+  // is per-thread state: an iterator must be used and destroyed on the
+  // thread that created it, and a long-lived one delays reclamation.
+  class Iterator {
+   public:
+    friend SkipList<Key, T>;
+
+    Iterator();
+
+    iterator &operator++();
+    iterator operator++(int);
+    const_reference operator*() const;
+    const key_type &key() const;
+    bool operator==(const iterator &it) const;
+    bool operator!=(const iterator &it) const;
+
+   protected:
+    EpochDomain::Guard guard;
+    Node *node;
+
+    explicit Iterator(Node *node);
+  };
+
+ protected:
+  Node *head;
+  std::atomic<size_type> elementCount;
+
+  static bool isMarked(uintptr_t word);
+  static Node *pointer(uintptr_t word);
+  static uintptr_t word(Node *node);
+  static int randomHeight();
+  static Node *allocateNode(int height);
+  static void deleteNode(void *ptr);
+  static void deleteValue(void *ptr);
+  static Node *nextLive(Node *node);
+
+  bool search(const key_type &key, Node **preds, Node **succs) const;
+  Node *lowerNode(const key_type &key) const;
+  Node *upperNode(const key_type &key) const;
+  template <typename... Args>
+  std::pair<iterator, bool> insertNode(const key_type &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> assignNode(const key_type &key, Args &&...args);
+  bool markNode(Node *node);
+  void releaseNode(Node *node);
+};
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename T>
+SkipList<Key, T>::SkipList()
+    : head(allocateNode(kMaxHeight)), elementCount(0) {}
+
+// Not safe against concurrent use: no other thread may touch a container
+// that is being destroyed. Removed nodes are already retired, everything
+// still linked at level 0 is freed here.
+template <typename Key, typename T>
+SkipList<Key, T>::~SkipList() {
+  Node *node = pointer(head->link(0).load(std::memory_order_acquire));
+  while (node != nullptr) {
+    Node *next = pointer(node->link(0).load(std::memory_order_relaxed));
+    deleteNode(node);
+    node = next;
+  }
+  head->~Node();
+  ::operator delete(head);
+}
+
+/***************************
+ * SkipList container methods (public)
+ * *************************/
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::iterator SkipList<Key, T>::begin() const {
+  Iterator it;
+  it.node = nextLive(head);
+  return it;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::iterator SkipList<Key, T>::end() const {
+  return Iterator();
+}
+
+template <typename Key, typename T>
+bool SkipList<Key, T>::empty() const {
+  return begin() == end();
+}
+
+// Exact only when no writer runs concurrently.
+template <typename Key, typename T>
+typename SkipList<Key, T>::size_type SkipList<Key, T>::size() const {
+  return elementCount.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename T>
+void SkipList<Key, T>::clear() {
+  EpochDomain::Guard guard;
+  for (Node *node = nextLive(head); node != nullptr; node = nextLive(node))
+    erase(node->key());
+}
+
+template <typename Key, typename T>
+bool SkipList<Key, T>::erase(const key_type &key) {
+  EpochDomain::Guard guard;
+  Node *preds[kMaxHeight], *succs[kMaxHeight];
+  if (!search(key, preds, succs)) return false;
+
+  Node *node = succs[0];
+  if (!markNode(node)) return false;
+  elementCount.fetch_sub(1, std::memory_order_relaxed);
+  search(key, preds, succs);
+  releaseNode(node);
+  return true;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::iterator SkipList<Key, T>::find(
+    const key_type &key) const {
+  Iterator it;
+  Node *node = lowerNode(key);
+  if (node != nullptr && !(key < node->key())) it.node = node;
+  return it;
+}
+
+template <typename Key, typename T>
+bool SkipList<Key, T>::contains(const key_type &key) const {
+  EpochDomain::Guard guard;
+  Node *node = lowerNode(key);
+  return node != nullptr && !(key < node->key());
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::iterator SkipList<Key, T>::lower_bound(
+    const key_type &key) const {
+  Iterator it;
+  it.node = lowerNode(key);
+  return it;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::iterator SkipList<Key, T>::upper_bound(
+    const key_type &key) const {
+  Iterator it;
+  it.node = upperNode(key);
+  return it;
+}
+
+/***************************
+ * Iterator methods
+ * *************************/
+
+template <typename Key, typename T>
+SkipList<Key, T>::Iterator::Iterator() : guard(), node(nullptr) {}
+
+template <typename Key, typename T>
+SkipList<Key, T>::Iterator::Iterator(Node *node) : guard(), node(node) {}
+
+// Skips nodes removed since the iterator got here, so iteration only yields
+// live elements in key order, though not a snapshot of the whole list.
+template <typename Key, typename T>
+typename SkipList<Key, T>::iterator &SkipList<Key, T>::Iterator::operator++() {
+  if (node != nullptr) node = nextLive(node);
+  return *this;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::iterator SkipList<Key, T>::Iterator::operator++(
+    int) {
+  iterator tmp = *this;
+  ++(*this);
+  return tmp;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::const_reference
+SkipList<Key, T>::Iterator::operator*() const {
+  if constexpr (std::is_void<T>::value)
+    return node->key();
+  else
+    return *node->value.load(std::memory_order_acquire);
+}
+
+template <typename Key, typename T>
+const typename SkipList<Key, T>::key_type &SkipList<Key, T>::Iterator::key()
+    const {
+  return node->key();
+}
+
+template <typename Key, typename T>
+bool SkipList<Key, T>::Iterator::operator==(const iterator &it) const {
+  return node == it.node;
+}
+
+template <typename Key, typename T>
+bool SkipList<Key, T>::Iterator::operator!=(const iterator &it) const {
+  return !(*this == it);
+}
+
+/***************************
+ * SkipList inner methods (protected)
+ * *************************/
+
+template <typename Key, typename T>
+bool SkipList<Key, T>::isMarked(uintptr_t word) {
+  return word & 1;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::Node *SkipList<Key, T>::pointer(uintptr_t word) {
+  return reinterpret_cast<Node *>(word & ~static_cast<uintptr_t>(1));
+}
+
+template <typename Key, typename T>
+uintptr_t SkipList<Key, T>::word(Node *node) {
+  return reinterpret_cast<uintptr_t>(node);
+}
+
+// Geometric with p = 1/2: two pointers per node on average, and about two
+// nodes looked at per level. kMaxHeight levels cover 2^24 elements.
+template <typename Key, typename T>
+int SkipList<Key, T>::randomHeight() {
+  static thread_local uint64_t state =
+      reinterpret_cast<uintptr_t>(&state) * 0x9E3779B97F4A7C15ull | 1;
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+
+  int height = 1;
+  for (uint64_t bits = state; height < kMaxHeight && (bits & 1) == 0;
+       bits >>= 1)
+    ++height;
+  return height;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::Node *SkipList<Key, T>::allocateNode(int height) {
+  void *raw =
+      ::operator new(sizeof(Node) + height * sizeof(std::atomic<uintptr_t>));
+  Node *node = new (raw) Node;
+  node->height = height;
+  for (int level = 0; level < height; ++level)
+    new (reinterpret_cast<std::atomic<uintptr_t> *>(node + 1) + level)
+        std::atomic<uintptr_t>(0);
+  return node;
+}
+
+template <typename Key, typename T>
+void SkipList<Key, T>::deleteNode(void *ptr) {
+  Node *node = static_cast<Node *>(ptr);
+  node->key().~Key();
+  if constexpr (!std::is_void<T>::value)
+    delete node->value.load(std::memory_order_relaxed);
+  node->~Node();
+  ::operator delete(ptr);
+}
+
+template <typename Key, typename T>
+void SkipList<Key, T>::deleteValue(void *ptr) {
+  if constexpr (!std::is_void<T>::value) delete static_cast<T *>(ptr);
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::Node *SkipList<Key, T>::nextLive(Node *node) {
+  Node *next = pointer(node->link(0).load(std::memory_order_acquire));
+  while (next != nullptr &&
+         isMarked(next->link(0).load(std::memory_order_acquire)))
+    next = pointer(next->link(0).load(std::memory_order_acquire));
+  return next;
+}
+
+// Fills preds/succs with the last node before key and the first node not
+// before it on every level, unlinking marked nodes on the way. Starts over
+// when an unlink fails, since the predecessor has been removed or changed.
+template <typename Key, typename T>
+bool SkipList<Key, T>::search(const key_type &key, Node **preds,
+                              Node **succs) const {
+retry:
+  Node *pred = head;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    Node *curr = pointer(pred->link(level).load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t succ = curr->link(level).load(std::memory_order_acquire);
+      if (isMarked(succ)) {
+        uintptr_t expected = word(curr);
+        if (!pred->link(level).compare_exchange_strong(
+                expected, succ & ~static_cast<uintptr_t>(1)))
+          goto retry;
+        curr = pointer(succ);
+      } else if (curr->key() < key) {
+        pred = curr;
+        curr = pointer(succ);
+      } else {
+        break;
+      }
+    }
+    preds[level] = pred;
+    succs[level] = curr;
+  }
+  return succs[0] != nullptr && !(key < succs[0]->key());
+}
+
+// Read-only descent used by lookups: steps over marked nodes instead of
+// unlinking them, so readers never write to shared memory.
+template <typename Key, typename T>
+typename SkipList<Key, T>::Node *SkipList<Key, T>::lowerNode(
+    const key_type &key) const {
+  Node *pred = head, *curr = nullptr;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    curr = pointer(pred->link(level).load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t succ = curr->link(level).load(std::memory_order_acquire);
+      if (!isMarked(succ) && !(curr->key() < key)) break;
+      if (!isMarked(succ)) pred = curr;
+      curr = pointer(succ);
+    }
+  }
+  return curr;
+}
+
+template <typename Key, typename T>
+typename SkipList<Key, T>::Node *SkipList<Key, T>::upperNode(
+    const key_type &key) const {
+  Node *pred = head, *curr = nullptr;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    curr = pointer(pred->link(level).load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t succ = curr->link(level).load(std::memory_order_acquire);
+      if (!isMarked(succ) && key < curr->key()) break;
+      if (!isMarked(succ)) pred = curr;
+      curr = pointer(succ);
+    }
+  }
+  return curr;
+}
+
+// Publishing at level 0 is the linearization point; the upper levels are
+// only shortcuts and are linked afterwards. Linking stops as soon as the
+// node is found marked, and a final search makes sure no level still points
+// at a node removed in the meantime.
+template <typename Key, typename T>
+template <typename... Args>
+std::pair<typename SkipList<Key, T>::iterator, bool>
+SkipList<Key, T>::insertNode(const key_type &key, Args &&...args) {
+  EpochDomain::Guard guard;
+  Node *preds[kMaxHeight], *succs[kMaxHeight];
+  Node *node = nullptr;
+  while (true) {
+    if (search(key, preds, succs)) {
+      if (node != nullptr) deleteNode(node);
+      return std::pair<iterator, bool>(Iterator(succs[0]), false);
+    }
+    if (node == nullptr) {
+      node = allocateNode(randomHeight());
+      new (node->storage) Key(key);
+      if constexpr (!std::is_void<T>::value)
+        node->value.store(new T(std::forward<Args>(args)...),
+                          std::memory_order_relaxed);
+    }
+    for (int level = 0; level < node->height; ++level)
+      node->link(level).store(word(succs[level]), std::memory_order_relaxed);
+    uintptr_t expected = word(succs[0]);
+    if (preds[0]->link(0).compare_exchange_strong(expected, word(node)))
+      break;
+  }
+  elementCount.fetch_add(1, std::memory_order_relaxed);
+
+  bool linking = true;
+  for (int level = 1; linking && level < node->height; ++level) {
+    while (true) {
+      uintptr_t current = node->link(level).load(std::memory_order_acquire);
+      if (isMarked(current) ||
+          (pointer(current) != succs[level] &&
+           !node->link(level).compare_exchange_strong(current,
+                                                      word(succs[level])))) {
+        linking = false;
+        break;
+      }
+      uintptr_t expected = word(succs[level]);
+      if (preds[level]->link(level).compare_exchange_strong(expected,
+                                                            word(node)))
+        break;
+      if (!search(key, preds, succs) || succs[0] != node) {
+        linking = false;
+        break;
+      }
+    }
+  }
+
+  iterator it(node);
+  if (isMarked(node->link(0).load(std::memory_order_acquire)))
+    search(key, preds, succs);
+  releaseNode(node);
+  return std::pair<iterator, bool>(it, true);
+}
+
+// Replaces the mapped value of key, or inserts it. The old value is retired
+// rather than destroyed because readers may still be copying it.
+template <typename Key, typename T>
+template <typename... Args>
+std::pair<typename SkipList<Key, T>::iterator, bool>
+SkipList<Key, T>::assignNode(const key_type &key, Args &&...args) {
+  EpochDomain::Guard guard;
+  while (true) {
+    Node *node = lowerNode(key);
+    if (node != nullptr && !(key < node->key())) {
+      T *old = node->value.exchange(new T(args...), std::memory_order_acq_rel);
+      EpochDomain::instance().retire(old, &deleteValue);
+      return std::pair<iterator, bool>(Iterator(node), false);
+    }
+    std::pair<iterator, bool> result = insertNode(key, args...);
+    if (result.second) return result;
+  }
+}
+
+// Marks every level from the top down. Returns whether this thread marked
+// level 0 and so owns the removal.
+template <typename Key, typename T>
+bool SkipList<Key, T>::markNode(Node *node) {
+  for (int level = node->height - 1; level > 0; --level) {
+    uintptr_t current = node->link(level).load(std::memory_order_acquire);
+    while (!isMarked(current) &&
+           !node->link(level).compare_exchange_weak(current, current | 1)) {
+    }
+  }
+
+  uintptr_t current = node->link(0).load(std::memory_order_acquire);
+  while (!isMarked(current)) {
+    if (node->link(0).compare_exchange_weak(current, current | 1)) return true;
+  }
+  return false;
+}
+
+template <typename Key, typename T>
+void SkipList<Key, T>::releaseNode(Node *node) {
+  if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    EpochDomain::instance().retire(node, &deleteNode);
+}
+}  // namespace s21
+
+#endif
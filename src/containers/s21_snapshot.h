@@ -0,0 +1,532 @@
+#ifndef __S21_CONTAINERS_SNAPSHOT_H__
+#define __S21_CONTAINERS_SNAPSHOT_H__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_RBTree.h"
+#include "s21_multiset.h"
+
+namespace s21 {
+// One element of a snapshot file. Snapshots are raw memory images, so only
+// trivially copyable keys and values can go in one.
+template <typename Key, typename T>
+struct SnapshotRecord {
+  static_assert(std::is_trivially_copyable<Key>::value &&
+                    std::is_trivially_copyable<T>::value,
+                "snapshots hold trivially copyable keys and values only");
+
+  Key key;
+  T mapped;
+};
+
+template <typename Key>
+struct SnapshotRecord<Key, void> {
+  static_assert(std::is_trivially_copyable<Key>::value,
+                "snapshots hold trivially copyable keys and values only");
+
+  Key key;
+};
+
+// A snapshot file is this header followed by count records in key order.
+// Numbers are stored in host byte order; byteOrder tells a file written on
+// a machine of the other endianness apart. The header takes 64 bytes so
+// that the records after it stay aligned in a page-aligned mapping.
+struct SnapshotHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t recordSize;
+  uint32_t keySize;
+  uint32_t mappedSize;
+  uint32_t reserved0;
+  uint64_t count;
+  char reserved[24];
+
+  static constexpr char kMagic[8] = "s21snap";
+  static constexpr uint32_t kVersion = 1;
+  static constexpr uint32_t kByteOrder = 0x01020304;
+
+  template <typename Key, typename T>
+  static SnapshotHeader of(uint64_t count);
+  bool matches(const SnapshotHeader &expected) const;
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "snapshot header must be 64 bytes");
+
+// Writes a snapshot next to path and renames it over path on commit(), so
+// readers see either the old file or the complete new one.
+class SnapshotWriter {
+ public:
+  using size_type = size_t;
+
+  SnapshotWriter(const std::string &path, const SnapshotHeader &header);
+  SnapshotWriter(const SnapshotWriter &other) = delete;
+  ~SnapshotWriter();
+  SnapshotWriter &operator=(const SnapshotWriter &other) = delete;
+
+  void write(const void *data, size_type bytes);
+  void commit();
+
+ private:
+  static constexpr size_type kBufferSize = size_type(1) << 20;
+
+  std::string path_;
+  std::string temporary_;
+  FILE *file_;
+
+  [[noreturn]] void fail(const char *what);
+};
+
+// Read-only mapping of a snapshot file, checked against the header the
+// caller expects before any record is handed out.
+class SnapshotFile {
+ public:
+  using size_type = size_t;
+
+  SnapshotFile(const std::string &path, const SnapshotHeader &expected);
+  SnapshotFile(const SnapshotFile &other) = delete;
+  SnapshotFile(SnapshotFile &&other);
+  ~SnapshotFile();
+  SnapshotFile &operator=(const SnapshotFile &other) = delete;
+  SnapshotFile &operator=(SnapshotFile &&other);
+
+  template <typename Record>
+  const Record *records() const;
+  size_type size() const;
+  void adviseSequential() const;
+  void swap(SnapshotFile &other);
+
+ private:
+  void *data_;
+  size_type length_;
+  size_type count_;
+
+  void release();
+};
+
+// Sorted container served straight from a snapshot file: lookups search the
+// mapped records in place, so opening one costs an mmap whatever its size
+// and pages are read only when touched. Files written by set, multiset and
+// map can all be opened; see snapshot_set and snapshot_map.
+template <typename Key, typename T>
+class SnapshotView {
+ public:
+  using key_type = Key;
+  using value_type = SnapshotRecord<Key, T>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+  using size_type = size_t;
+
+  explicit SnapshotView(const std::string &path);
+  SnapshotView(SnapshotView &&other);
+  ~SnapshotView() = default;
+  SnapshotView &operator=(SnapshotView &&other);
+
+  const_iterator begin() const;
+  const_iterator end() const;
+  bool empty() const;
+  size_type size() const;
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  const_iterator lower_bound(const Key &key) const;
+  const_iterator upper_bound(const Key &key) const;
+  std::pair<const_iterator, const_iterator> equal_range(const Key &key) const;
+  void swap(SnapshotView &other);
+
+ protected:
+  SnapshotFile file_;
+  const value_type *records_;
+};
+
+// Writes trees to snapshots and rebuilds them from one. A friend of RBTree:
+// save walks the nodes with its own stack and load links the records into a
+// balanced tree directly, without going through insert.
+class SnapshotIO {
+ public:
+  template <typename Key, typename Value, typename Allocator>
+  static void save(RBTree<Key, Value, Allocator> &tree,
+                   const std::string &path);
+  template <typename Key, typename Value, typename Allocator>
+  static void load(RBTree<Key, Value, Allocator> &tree,
+                   const std::string &path, bool isUnique);
+};
+
+template <typename Key, typename Value, typename Allocator>
+void save_snapshot(RBTree<Key, Value, Allocator> &tree,
+                   const std::string &path);
+template <typename Key, typename Value, typename Allocator>
+void load_snapshot(RBTree<Key, Value, Allocator> &tree,
+                   const std::string &path);
+template <typename Key, typename Allocator>
+void load_snapshot(multiset<Key, Allocator> &tree, const std::string &path);
+
+/***************************
+ * SnapshotHeader
+ * *************************/
+
+template <typename Key, typename T>
+SnapshotHeader SnapshotHeader::of(uint64_t count) {
+  SnapshotHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(header.magic));
+  header.version = kVersion;
+  header.byteOrder = kByteOrder;
+  header.recordSize = sizeof(SnapshotRecord<Key, T>);
+  header.keySize = sizeof(Key);
+  if constexpr (!std::is_void<T>::value) header.mappedSize = sizeof(T);
+  header.count = count;
+  return header;
+}
+
+inline bool SnapshotHeader::matches(const SnapshotHeader &expected) const {
+  return std::memcmp(magic, kMagic, sizeof(magic)) == 0 &&
+         version == kVersion && byteOrder == kByteOrder &&
+         recordSize == expected.recordSize && keySize == expected.keySize &&
+         mappedSize == expected.mappedSize;
+}
+
+/***************************
+ * SnapshotWriter
+ * *************************/
+
+inline SnapshotWriter::SnapshotWriter(const std::string &path,
+                                      const SnapshotHeader &header)
+    : path_(path), temporary_(path + ".tmp"), file_(nullptr) {
+  file_ = std::fopen(temporary_.c_str(), "wb");
+  if (file_ == nullptr) fail("cannot create");
+  std::setvbuf(file_, nullptr, _IOFBF, kBufferSize);
+  write(&header, sizeof(header));
+}
+
+inline SnapshotWriter::~SnapshotWriter() {
+  if (file_ == nullptr) return;
+  std::fclose(file_);
+  std::remove(temporary_.c_str());
+}
+
+inline void SnapshotWriter::write(const void *data, size_type bytes) {
+  if (std::fwrite(data, 1, bytes, file_) != bytes) fail("cannot write");
+}
+
+inline void SnapshotWriter::commit() {
+  if (std::fflush(file_) != 0 || ::fsync(fileno(file_)) != 0)
+    fail("cannot write");
+  FILE *file = file_;
+  file_ = nullptr;
+  if (std::fclose(file) != 0 ||
+      std::rename(temporary_.c_str(), path_.c_str()) != 0) {
+    int error = errno;
+    std::remove(temporary_.c_str());
+    throw std::system_error(error, std::generic_category(),
+                            "s21: cannot write " + path_);
+  }
+}
+
+// Drops the partial file before throwing, leaving whatever was at path.
+inline void SnapshotWriter::fail(const char *what) {
+  int error = errno;
+  if (file_ != nullptr) {
+    std::fclose(file_);
+    file_ = nullptr;
+    std::remove(temporary_.c_str());
+  }
+  throw std::system_error(error, std::generic_category(),
+                          std::string("s21: ") + what + " " + temporary_);
+}
+
+/***************************
+ * SnapshotFile
+ * *************************/
+
+inline SnapshotFile::SnapshotFile(const std::string &path,
+                                  const SnapshotHeader &expected)
+    : data_(nullptr), length_(0), count_(0) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    throw std::system_error(errno, std::generic_category(),
+                            "s21: cannot open " + path);
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    int error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category(),
+                            "s21: cannot open " + path);
+  }
+
+  length_ = static_cast<size_type>(info.st_size);
+  if (length_ >= sizeof(SnapshotHeader)) {
+    data_ = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+    int error = errno;
+    ::close(fd);
+    if (data_ == MAP_FAILED) {
+      data_ = nullptr;
+      throw std::system_error(error, std::generic_category(),
+                              "s21: cannot map " + path);
+    }
+  } else {
+    ::close(fd);
+  }
+
+  const SnapshotHeader *header = static_cast<SnapshotHeader *>(data_);
+  size_type payload = length_ - sizeof(SnapshotHeader);
+  if (header == nullptr || !header->matches(expected) ||
+      payload % expected.recordSize != 0 ||
+      header->count != payload / expected.recordSize) {
+    release();
+    throw std::runtime_error("s21: " + path +
+                             " is not a snapshot of this container type");
+  }
+  count_ = header->count;
+}
+
+inline SnapshotFile::SnapshotFile(SnapshotFile &&other)
+    : data_(nullptr), length_(0), count_(0) {
+  swap(other);
+}
+
+inline SnapshotFile::~SnapshotFile() { release(); }
+
+inline SnapshotFile &SnapshotFile::operator=(SnapshotFile &&other) {
+  if (this != &other) {
+    release();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Record>
+const Record *SnapshotFile::records() const {
+  return reinterpret_cast<const Record *>(static_cast<const char *>(data_) +
+                                          sizeof(SnapshotHeader));
+}
+
+inline SnapshotFile::size_type SnapshotFile::size() const { return count_; }
+
+// Hints that the records are about to be read once, front to back, so the
+// kernel reads ahead aggressively and drops pages behind the reader.
+inline void SnapshotFile::adviseSequential() const {
+  if (data_ == nullptr) return;
+  ::madvise(data_, length_, MADV_SEQUENTIAL);
+  ::madvise(data_, length_, MADV_WILLNEED);
+}
+
+inline void SnapshotFile::swap(SnapshotFile &other) {
+  std::swap(data_, other.data_);
+  std::swap(length_, other.length_);
+  std::swap(count_, other.count_);
+}
+
+inline void SnapshotFile::release() {
+  if (data_ != nullptr) ::munmap(data_, length_);
+  data_ = nullptr;
+  length_ = 0;
+  count_ = 0;
+}
+
+/***************************
+ * SnapshotView
+ * *************************/
+
+template <typename Key, typename T>
+SnapshotView<Key, T>::SnapshotView(const std::string &path)
+    : file_(path, SnapshotHeader::of<Key, T>(0)),
+      records_(file_.records<value_type>()) {}
+
+template <typename Key, typename T>
+SnapshotView<Key, T>::SnapshotView(SnapshotView &&other)
+    : file_(std::move(other.file_)), records_(other.records_) {
+  other.records_ = nullptr;
+}
+
+template <typename Key, typename T>
+SnapshotView<Key, T> &SnapshotView<Key, T>::operator=(SnapshotView &&other) {
+  if (this != &other) {
+    file_ = std::move(other.file_);
+    records_ = other.records_;
+    other.records_ = nullptr;
+  }
+  return *this;
+}
+
+template <typename Key, typename T>
+typename SnapshotView<Key, T>::const_iterator SnapshotView<Key, T>::begin()
+    const {
+  return records_;
+}
+
+template <typename Key, typename T>
+typename SnapshotView<Key, T>::const_iterator SnapshotView<Key, T>::end()
+    const {
+  return records_ + file_.size();
+}
+
+template <typename Key, typename T>
+bool SnapshotView<Key, T>::empty() const {
+  return file_.size() == 0;
+}
+
+template <typename Key, typename T>
+typename SnapshotView<Key, T>::size_type SnapshotView<Key, T>::size() const {
+  return file_.size();
+}
+
+template <typename Key, typename T>
+typename SnapshotView<Key, T>::const_iterator SnapshotView<Key, T>::find(
+    const Key &key) const {
+  const_iterator it = lower_bound(key);
+  return it != end() && !(key < it->key) ? it : end();
+}
+
+template <typename Key, typename T>
+bool SnapshotView<Key, T>::contains(const Key &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename T>
+typename SnapshotView<Key, T>::size_type SnapshotView<Key, T>::count(
+    const Key &key) const {
+  std::pair<const_iterator, const_iterator> range = equal_range(key);
+  return static_cast<size_type>(range.second - range.first);
+}
+
+template <typename Key, typename T>
+typename SnapshotView<Key, T>::const_iterator SnapshotView<Key, T>::lower_bound(
+    const Key &key) const {
+  return std::lower_bound(
+      begin(), end(), key,
+      [](const value_type &record, const Key &k) { return record.key < k; });
+}
+
+template <typename Key, typename T>
+typename SnapshotView<Key, T>::const_iterator SnapshotView<Key, T>::upper_bound(
+    const Key &key) const {
+  return std::upper_bound(
+      begin(), end(), key,
+      [](const Key &k, const value_type &record) { return k < record.key; });
+}
+
+template <typename Key, typename T>
+std::pair<typename SnapshotView<Key, T>::const_iterator,
+          typename SnapshotView<Key, T>::const_iterator>
+SnapshotView<Key, T>::equal_range(const Key &key) const {
+  return std::pair<const_iterator, const_iterator>(lower_bound(key),
+                                                   upper_bound(key));
+}
+
+template <typename Key, typename T>
+void SnapshotView<Key, T>::swap(SnapshotView &other) {
+  file_.swap(other.file_);
+  std::swap(records_, other.records_);
+}
+
+/***************************
+ * SnapshotIO
+ * *************************/
+
+template <typename Key, typename Value, typename Allocator>
+void SnapshotIO::save(RBTree<Key, Value, Allocator> &tree,
+                      const std::string &path) {
+  using Node = typename RBTree<Key, Value, Allocator>::Node;
+  using Record = SnapshotRecord<Key, Value>;
+  SnapshotWriter writer(path, SnapshotHeader::of<Key, Value>(tree.size()));
+
+  // Records are built over zeroed bytes so the padding written is zero too.
+  // The walk keeps its own stack: climbing parent pointers from node to
+  // successor touches cold nodes twice and is several times slower.
+  alignas(Record) unsigned char bytes[sizeof(Record)] = {};
+  Node *stack[RBTree<Key, Value, Allocator>::kMaxHeight];
+  size_t depth = 0;
+  for (Node *node = tree.root; node != nullptr || depth > 0;
+       node = node->right) {
+    for (; node != nullptr; node = node->left) stack[depth++] = node;
+    node = stack[--depth];
+    const Record *record;
+    if constexpr (std::is_void<Value>::value)
+      record = ::new (bytes) Record{node->key};
+    else
+      record = ::new (bytes) Record{node->key, node->mapped};
+    writer.write(record, sizeof(Record));
+  }
+  writer.commit();
+}
+
+template <typename Key, typename Value, typename Allocator>
+void SnapshotIO::load(RBTree<Key, Value, Allocator> &tree,
+                      const std::string &path, bool isUnique) {
+  using Tree = RBTree<Key, Value, Allocator>;
+  using Record = SnapshotRecord<Key, Value>;
+  SnapshotFile file(path, SnapshotHeader::of<Key, Value>(0));
+  file.adviseSequential();
+  tree.clear();
+
+  const Record *records = file.records<Record>();
+  typename Tree::Node *trees[Tree::kMaxHeight] = {};
+  typename Tree::Node *separators[Tree::kMaxHeight] = {};
+  try {
+    for (size_t i = 0; i < file.size(); ++i) {
+      if (i > 0 &&
+          !Tree::inOrder(records[i - 1].key, records[i].key, !isUnique))
+        throw std::runtime_error("s21: " + path + " is not sorted");
+      if constexpr (std::is_void<Value>::value)
+        Tree::appendSorted(tree.createNode(std::in_place, records[i].key),
+                           trees, separators);
+      else
+        Tree::appendSorted(tree.createNode(std::in_place, records[i].key,
+                                           records[i].mapped),
+                           trees, separators);
+    }
+  } catch (...) {
+    tree.assignRoot(tree.finishSorted(trees, separators).root);
+    tree.clear();
+    throw;
+  }
+  tree.assignRoot(tree.finishSorted(trees, separators).root);
+}
+
+// Writes the elements of a set, map or multiset in key order to a binary
+// snapshot at path, see SnapshotHeader. Keys and mapped values must be
+// trivially copyable.
+template <typename Key, typename Value, typename Allocator>
+void save_snapshot(RBTree<Key, Value, Allocator> &tree,
+                   const std::string &path) {
+  SnapshotIO::save(tree, path);
+}
+
+// Replaces the contents of a set or map with a snapshot written by
+// save_snapshot. The file is mapped rather than read and its records,
+// already in key order, are linked into a balanced tree as they are copied
+// out: O(n), with no sorting and no rebalancing. Throws, leaving the tree
+// empty, if the file does not hold the tree's types or its keys are out of
+// order.
+template <typename Key, typename Value, typename Allocator>
+void load_snapshot(RBTree<Key, Value, Allocator> &tree,
+                   const std::string &path) {
+  SnapshotIO::load(tree, path, true);
+}
+
+// Same for a multiset, which accepts equal keys.
+template <typename Key, typename Allocator>
+void load_snapshot(multiset<Key, Allocator> &tree, const std::string &path) {
+  SnapshotIO::load(tree, path, false);
+}
+
+}  // namespace s21
+
+#endif
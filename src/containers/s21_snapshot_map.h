@@ -0,0 +1,42 @@
+#ifndef __S21_CONTAINERS_SNAPSHOT_MAP_H__
+#define __S21_CONTAINERS_SNAPSHOT_MAP_H__
+
+#include "s21_snapshot.h"
+
+namespace s21 {
+// Read-only map over a map written by save_snapshot. Iterators point at
+// records with key and mapped members.
+template <typename Key, typename T>
+class snapshot_map : public SnapshotView<Key, T> {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = typename SnapshotView<Key, T>::value_type;
+  using const_reference = const value_type &;
+  using iterator = typename SnapshotView<Key, T>::iterator;
+  using const_iterator = typename SnapshotView<Key, T>::const_iterator;
+  using size_type = size_t;
+
+  explicit snapshot_map(const std::string &path)
+      : SnapshotView<Key, T>(path){};
+  snapshot_map(snapshot_map &&other) : SnapshotView<Key, T>(std::move(other)){};
+  ~snapshot_map() = default;
+  snapshot_map &operator=(snapshot_map &&other) {
+    SnapshotView<Key, T>::operator=(std::move(other));
+    return *this;
+  };
+
+  // Element access
+  const T &at(const Key &key) const;
+};
+
+template <typename Key, typename T>
+const T &snapshot_map<Key, T>::at(const Key &key) const {
+  const_iterator it = this->find(key);
+  if (it == this->end()) throw std::out_of_range("no such element exists");
+  return it->mapped;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef __S21_CONTAINERS_SNAPSHOT_SET_H__
+#define __S21_CONTAINERS_SNAPSHOT_SET_H__
+
+#include "s21_snapshot.h"
+
+namespace s21 {
+// Read-only set over a set or multiset written by save_snapshot.
+template <typename Key>
+class snapshot_set : public SnapshotView<Key, void> {
+ public:
+  using key_type = Key;
+  using value_type = typename SnapshotView<Key, void>::value_type;
+  using const_reference = const value_type&;
+  using iterator = typename SnapshotView<Key, void>::iterator;
+  using const_iterator = typename SnapshotView<Key, void>::const_iterator;
+  using size_type = size_t;
+
+  explicit snapshot_set(const std::string& path)
+      : SnapshotView<Key, void>(path){};
+  snapshot_set(snapshot_set&& other)
+      : SnapshotView<Key, void>(std::move(other)){};
+  ~snapshot_set() = default;
+  snapshot_set& operator=(snapshot_set&& other) {
+    SnapshotView<Key, void>::operator=(std::move(other));
+    return *this;
+  };
+};
+
+}  // namespace s21
+
+#endif
@@ -3,20 +3,25 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <utility>
 
 namespace s21 {
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class stack {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
 
   // Member functions
   stack() : l() {}
-  stack(std::initializer_list<value_type> const &items) : l() {
+  explicit stack(const Allocator &alloc) : l(alloc) {}
+  stack(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator())
+      : l(alloc) {
     for (auto it : items) l.push_front(it);
   }
   stack(const stack &s) : l(s.l) {}
@@ -44,7 +49,7 @@ class stack {
   }
 
  private:
-  s21::list<value_type> l;
+  s21::list<value_type, Allocator> l;
 };
 };  // namespace s21
 #endif
\ No newline at end of file
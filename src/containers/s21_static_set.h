@@ -0,0 +1,556 @@
+#ifndef __S21_CONTAINERS_STATIC_SET_H__
+#define __S21_CONTAINERS_STATIC_SET_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "s21_RBTree.h"
+
+namespace s21 {
+// Both layouts number the keys as a complete binary search tree in
+// breadth-first order: index 1 is the root, the children of index k are 2k
+// and 2k + 1, and an in-order walk of the indices visits the keys sorted.
+// A layout decides in which slot of the key array each index is stored and
+// runs the search over it. Index 0 stands for "no key".
+
+// Slot k holds index k. The nodes a few levels below k are contiguous, so
+// while the descent compares at k it prefetches the line holding all of k's
+// descendants that deep (four levels for 4-byte keys), and reaches them
+// with the line already in cache.
+class EytzingerLayout {
+ public:
+  using size_type = size_t;
+
+  void reset(size_type count);
+  size_type slots(size_type count) const;
+  size_type slotOf(size_type index) const;
+  template <typename Key, typename Right>
+  size_type descend(const Key *keys, size_type count, Right right,
+                    size_type &slot) const;
+
+ private:
+  template <typename Key>
+  static constexpr size_type prefetchStride();
+};
+
+// Recursive van Emde Boas order: a tree of height h is stored as its top
+// h / 2 levels followed by each of the subtrees hanging below them, all laid
+// out the same way. Any subtree of height about log2(B) lies in O(1) blocks
+// of any size B, with no tuning to the cache. The array reserves slots for
+// the perfect tree of the same height, so up to about twice the keys.
+// The search finds slots from per-depth tables, see reset().
+class VanEmdeBoasLayout {
+ public:
+  using size_type = size_t;
+
+  VanEmdeBoasLayout();
+
+  void reset(size_type count);
+  size_type slots(size_type count) const;
+  size_type slotOf(size_type index) const;
+  template <typename Key, typename Right>
+  size_type descend(const Key *keys, size_type count, Right right,
+                    size_type &slot) const;
+
+ private:
+  static constexpr size_type kMaxDepth = std::numeric_limits<size_type>::digits;
+
+  size_type height_;
+  // For a node at depth d, the subtree it roots at that point of the
+  // recursion is stored after the top tree of topSize_[d] nodes whose root
+  // is at depth topDepth_[d], among siblings of bottomSize_[d] nodes each.
+  size_type topDepth_[kMaxDepth];
+  size_type topSize_[kMaxDepth];
+  size_type bottomSize_[kMaxDepth];
+
+  void split(size_type depth, size_type height);
+};
+
+// Read-only sorted set frozen from an s21::set or s21::multiset (or a sorted
+// range) into one flat array in a search-friendly layout. Keys carry no
+// pointers, and the descent computes the next slot from the comparison
+// instead of branching on it, so lookups on large sets run several times
+// faster than in the tree they were taken from.
+template <typename Key, typename Layout = EytzingerLayout>
+class static_set {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using size_type = size_t;
+
+  static_set();
+  template <typename Allocator>
+  explicit static_set(const RBTree<Key, void, Allocator> &tree);
+  template <typename InputIt>
+  static_set(InputIt first, InputIt last);
+  static_set(const static_set &other);
+  static_set(static_set &&other);
+  ~static_set();
+  static_set &operator=(static_set &&other);
+
+  iterator begin() const;
+  iterator end() const;
+  bool empty() const;
+  size_type size() const;
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+  void swap(static_set &other);
+
+  class Iterator {
+   public:
+    friend static_set<Key, Layout>;
+    const static_set *set;
+    size_type index;
+
+    Iterator();
+    Iterator(const static_set *set, size_type index);
+
+    iterator &operator++();
+    iterator operator++(int);
+    iterator &operator--();
+    iterator operator--(int);
+    reference operator*() const;
+    bool operator==(const iterator &it) const;
+    bool operator!=(const iterator &it) const;
+  };
+
+ protected:
+  static constexpr size_type kAlignment =
+      std::max<size_type>(64, alignof(Key));
+
+  Key *keys_;
+  size_type size_;
+  Layout layout_;
+
+  const Key &keyAt(size_type index) const;
+  size_type first() const;
+  size_type last() const;
+  size_type successor(size_type index) const;
+  size_type predecessor(size_type index) const;
+  template <typename Construct>
+  void build(size_type count, Construct construct);
+  void destroy(size_type count);
+};
+
+/***************************
+ * EytzingerLayout
+ * *************************/
+
+inline void EytzingerLayout::reset(size_type) {}
+
+inline EytzingerLayout::size_type EytzingerLayout::slots(
+    size_type count) const {
+  return count + 1;
+}
+
+inline EytzingerLayout::size_type EytzingerLayout::slotOf(
+    size_type index) const {
+  return index;
+}
+
+// Keeps going right while right(key) holds and returns the index of the
+// last node where it went left, that is the first key for which right is
+// false, or 0. The loop body has no branch on the comparison.
+template <typename Key, typename Right>
+EytzingerLayout::size_type EytzingerLayout::descend(const Key *keys,
+                                                    size_type count,
+                                                    Right right,
+                                                    size_type &slot) const {
+  size_type index = 1;
+  while (index <= count) {
+    __builtin_prefetch(keys + index * prefetchStride<Key>());
+    index = 2 * index + right(keys[index]);
+  }
+  index >>= __builtin_ctzll(~static_cast<unsigned long long>(index)) + 1;
+  slot = index;
+  return index;
+}
+
+// Descendants d levels below index k sit at k * 2^d onwards: the deepest
+// level whose 2^d nodes still fit one cache line.
+template <typename Key>
+constexpr EytzingerLayout::size_type EytzingerLayout::prefetchStride() {
+  size_type stride = 1;
+  while (stride * 2 * sizeof(Key) <= 64) stride *= 2;
+  return stride;
+}
+
+/***************************
+ * VanEmdeBoasLayout
+ * *************************/
+
+inline VanEmdeBoasLayout::VanEmdeBoasLayout() : height_(0) {}
+
+// The tables depend on the height alone. A node at depth d > 0 always roots
+// a bottom tree at some level of the recursion; its slot is then its top
+// tree root's slot, plus the top tree, plus one bottom tree per sibling to
+// its left, which the low bits of its index count.
+inline void VanEmdeBoasLayout::reset(size_type count) {
+  height_ = 0;
+  while (height_ < kMaxDepth && (count >> height_) != 0) ++height_;
+  topDepth_[0] = topSize_[0] = bottomSize_[0] = 0;
+  split(0, height_);
+}
+
+inline VanEmdeBoasLayout::size_type VanEmdeBoasLayout::slots(size_type) const {
+  return height_ == 0 ? 0 : (size_type(1) << height_) - 1;
+}
+
+inline VanEmdeBoasLayout::size_type VanEmdeBoasLayout::slotOf(
+    size_type index) const {
+  size_type depth = 0;
+  while ((index >> depth) > 1) ++depth;
+
+  size_type path[kMaxDepth];
+  path[0] = 0;
+  for (size_type d = 1; d <= depth; ++d) {
+    size_type ancestor = index >> (depth - d);
+    path[d] = path[topDepth_[d]] + topSize_[d] +
+              (ancestor & topSize_[d]) * bottomSize_[d];
+  }
+  return path[depth];
+}
+
+template <typename Key, typename Right>
+VanEmdeBoasLayout::size_type VanEmdeBoasLayout::descend(
+    const Key *keys, size_type count, Right right, size_type &slot) const {
+  size_type path[kMaxDepth];
+  size_type index = 1, depth = 0;
+  path[0] = 0;
+  while (index <= count) {
+    size_type at = path[topDepth_[depth]] + topSize_[depth] +
+                   (index & topSize_[depth]) * bottomSize_[depth];
+    path[depth++] = at;
+    index = 2 * index + right(keys[at]);
+  }
+  size_type up = __builtin_ctzll(~static_cast<unsigned long long>(index)) + 1;
+  index >>= up;
+  slot = index != 0 ? path[depth - up] : 0;
+  return index;
+}
+
+inline void VanEmdeBoasLayout::split(size_type depth, size_type height) {
+  if (height <= 1) return;
+  size_type top = height / 2, bottom = height - top;
+  topDepth_[depth + top] = depth;
+  topSize_[depth + top] = (size_type(1) << top) - 1;
+  bottomSize_[depth + top] = (size_type(1) << bottom) - 1;
+  split(depth, top);
+  split(depth + top, bottom);
+}
+
+/***************************
+ * Constructors
+ * *************************/
+
+template <typename Key, typename Layout>
+static_set<Key, Layout>::static_set() : keys_(nullptr), size_(0), layout_() {}
+
+// Walks the tree in order once, copying each key straight into its slot.
+template <typename Key, typename Layout>
+template <typename Allocator>
+static_set<Key, Layout>::static_set(const RBTree<Key, void, Allocator> &tree)
+    : static_set() {
+  using Tree = RBTree<Key, void, Allocator>;
+  typename Tree::Node *stack[Tree::kMaxHeight];
+  typename Tree::Node *node = tree.root;
+  size_type depth = 0;
+  build(Tree::sizeOf(tree.root), [&](Key *slot) {
+    for (; node != nullptr; node = node->left) stack[depth++] = node;
+    node = stack[--depth];
+    ::new (slot) Key(node->key);
+    node = node->right;
+  });
+}
+
+// [first, last) must be sorted.
+template <typename Key, typename Layout>
+template <typename InputIt>
+static_set<Key, Layout>::static_set(InputIt first, InputIt last)
+    : static_set() {
+  build(std::distance(first, last), [&](Key *slot) {
+    ::new (slot) Key(*first);
+    ++first;
+  });
+}
+
+template <typename Key, typename Layout>
+static_set<Key, Layout>::static_set(const static_set &other) : static_set() {
+  size_type index = other.first();
+  build(other.size_, [&](Key *slot) {
+    ::new (slot) Key(other.keyAt(index));
+    index = other.successor(index);
+  });
+}
+
+template <typename Key, typename Layout>
+static_set<Key, Layout>::static_set(static_set &&other) : static_set() {
+  swap(other);
+}
+
+template <typename Key, typename Layout>
+static_set<Key, Layout>::~static_set() {
+  destroy(size_);
+}
+
+template <typename Key, typename Layout>
+static_set<Key, Layout> &static_set<Key, Layout>::operator=(
+    static_set &&other) {
+  if (this != &other) {
+    destroy(size_);
+    swap(other);
+  }
+  return *this;
+}
+
+/***************************
+ * static_set methods (public)
+ * *************************/
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator static_set<Key, Layout>::begin()
+    const {
+  return Iterator(this, first());
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator static_set<Key, Layout>::end()
+    const {
+  return Iterator(this, 0);
+}
+
+template <typename Key, typename Layout>
+bool static_set<Key, Layout>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::size_type static_set<Key, Layout>::size()
+    const {
+  return size_;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator static_set<Key, Layout>::find(
+    const Key &key) const {
+  size_type slot;
+  size_type index = layout_.descend(
+      keys_, size_, [&key](const Key &probe) { return probe < key; }, slot);
+  if (index != 0 && key < keys_[slot]) index = 0;
+  return Iterator(this, index);
+}
+
+template <typename Key, typename Layout>
+bool static_set<Key, Layout>::contains(const Key &key) const {
+  size_type slot;
+  size_type index = layout_.descend(
+      keys_, size_, [&key](const Key &probe) { return probe < key; }, slot);
+  return index != 0 && !(key < keys_[slot]);
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::size_type static_set<Key, Layout>::count(
+    const Key &key) const {
+  size_type result = 0;
+  for (iterator it = lower_bound(key); it != end() && !(key < *it); ++it)
+    ++result;
+  return result;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator static_set<Key, Layout>::lower_bound(
+    const Key &key) const {
+  size_type slot;
+  return Iterator(this, layout_.descend(
+                            keys_, size_,
+                            [&key](const Key &probe) { return probe < key; },
+                            slot));
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator static_set<Key, Layout>::upper_bound(
+    const Key &key) const {
+  size_type slot;
+  return Iterator(this, layout_.descend(
+                            keys_, size_,
+                            [&key](const Key &probe) { return !(key < probe); },
+                            slot));
+}
+
+template <typename Key, typename Layout>
+std::pair<typename static_set<Key, Layout>::iterator,
+          typename static_set<Key, Layout>::iterator>
+static_set<Key, Layout>::equal_range(const Key &key) const {
+  return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename Layout>
+void static_set<Key, Layout>::swap(static_set &other) {
+  std::swap(keys_, other.keys_);
+  std::swap(size_, other.size_);
+  std::swap(layout_, other.layout_);
+}
+
+/***************************
+ * Iterator
+ * *************************/
+
+template <typename Key, typename Layout>
+static_set<Key, Layout>::Iterator::Iterator() : set(nullptr), index(0) {}
+
+template <typename Key, typename Layout>
+static_set<Key, Layout>::Iterator::Iterator(const static_set *set,
+                                            size_type index)
+    : set(set), index(index) {}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator &
+static_set<Key, Layout>::Iterator::operator++() {
+  index = set->successor(index);
+  return *this;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator
+static_set<Key, Layout>::Iterator::operator++(int) {
+  Iterator tmp = *this;
+  operator++();
+  return tmp;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator &
+static_set<Key, Layout>::Iterator::operator--() {
+  index = index == 0 ? set->last() : set->predecessor(index);
+  return *this;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::iterator
+static_set<Key, Layout>::Iterator::operator--(int) {
+  Iterator tmp = *this;
+  operator--();
+  return tmp;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::reference
+static_set<Key, Layout>::Iterator::operator*() const {
+  return set->keyAt(index);
+}
+
+template <typename Key, typename Layout>
+bool static_set<Key, Layout>::Iterator::operator==(const iterator &it) const {
+  return index == it.index;
+}
+
+template <typename Key, typename Layout>
+bool static_set<Key, Layout>::Iterator::operator!=(const iterator &it) const {
+  return index != it.index;
+}
+
+/***************************
+ * static_set inner methods (protected)
+ * *************************/
+
+template <typename Key, typename Layout>
+const Key &static_set<Key, Layout>::keyAt(size_type index) const {
+  return keys_[layout_.slotOf(index)];
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::size_type static_set<Key, Layout>::first()
+    const {
+  if (size_ == 0) return 0;
+  size_type index = 1;
+  while (2 * index <= size_) index = 2 * index;
+  return index;
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::size_type static_set<Key, Layout>::last()
+    const {
+  if (size_ == 0) return 0;
+  size_type index = 1;
+  while (2 * index + 1 <= size_) index = 2 * index + 1;
+  return index;
+}
+
+// Leftmost node of the right subtree, or else the parent of the nearest
+// ancestor reached by a left link: climbing past the trailing ones of the
+// index and one step more.
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::size_type
+static_set<Key, Layout>::successor(size_type index) const {
+  if (2 * index + 1 <= size_) {
+    index = 2 * index + 1;
+    while (2 * index <= size_) index = 2 * index;
+    return index;
+  }
+  unsigned long long bits = index;
+  return index >> (__builtin_ctzll(~bits) + 1);
+}
+
+template <typename Key, typename Layout>
+typename static_set<Key, Layout>::size_type
+static_set<Key, Layout>::predecessor(size_type index) const {
+  if (2 * index <= size_) {
+    index = 2 * index;
+    while (2 * index + 1 <= size_) index = 2 * index + 1;
+    return index;
+  }
+  return index >> (__builtin_ctzll(index) + 1);
+}
+
+// Allocates the slots and calls construct(slot) for the indices in order,
+// which must construct the next key in sorted order there.
+template <typename Key, typename Layout>
+template <typename Construct>
+void static_set<Key, Layout>::build(size_type count, Construct construct) {
+  if (count == 0) return;
+  layout_.reset(count);
+  keys_ = static_cast<Key *>(::operator new(
+      layout_.slots(count) * sizeof(Key), std::align_val_t(kAlignment)));
+  size_ = count;
+
+  size_type built = 0;
+  try {
+    for (size_type index = first(); index != 0; index = successor(index)) {
+      construct(keys_ + layout_.slotOf(index));
+      ++built;
+    }
+  } catch (...) {
+    destroy(built);
+    throw;
+  }
+}
+
+// Destroys the first count keys in order and frees the slots.
+template <typename Key, typename Layout>
+void static_set<Key, Layout>::destroy(size_type count) {
+  if (keys_ == nullptr) return;
+  for (size_type index = first(); count > 0; index = successor(index), --count)
+    keys_[layout_.slotOf(index)].~Key();
+  ::operator delete(keys_, std::align_val_t(kAlignment));
+  keys_ = nullptr;
+  size_ = 0;
+  layout_.reset(0);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef __S21_CONTAINERS_UNORDERED_MAP_H__
+#define __S21_CONTAINERS_UNORDERED_MAP_H__
+
+#include <stdexcept>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map : public HashTable<Key, T, Hash, KeyEqual, Allocator> {
+ public:
+  // Member types
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator =
+      typename HashTable<Key, T, Hash, KeyEqual, Allocator>::Iterator;
+  using const_iterator =
+      typename HashTable<Key, T, Hash, KeyEqual, Allocator>::ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  // Member functions
+  unordered_map() : HashTable<Key, T, Hash, KeyEqual, Allocator>(){};
+  explicit unordered_map(const Allocator &alloc)
+      : HashTable<Key, T, Hash, KeyEqual, Allocator>(alloc){};
+  unordered_map(std::initializer_list<value_type> const &items,
+                const Allocator &alloc = Allocator())
+      : unordered_map(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  unordered_map(InputIt first, InputIt last,
+                const Allocator &alloc = Allocator())
+      : HashTable<Key, T, Hash, KeyEqual, Allocator>(alloc) {
+    for (; first != last; ++first) insert(*first);
+  };
+  unordered_map(const unordered_map &m)
+      : HashTable<Key, T, Hash, KeyEqual, Allocator>(m){};
+  unordered_map(unordered_map &&m)
+      : HashTable<Key, T, Hash, KeyEqual, Allocator>(std::move(m)){};
+  ~unordered_map() = default;
+  unordered_map &operator=(unordered_map &&m) {
+    HashTable<Key, T, Hash, KeyEqual, Allocator>::operator=(std::move(m));
+    return *this;
+  };
+
+  // Element access
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+  // Modifiers
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+T &unordered_map<Key, T, Hash, KeyEqual, Allocator>::at(const Key &key) {
+  iterator it = this->find(key);
+  if (it == this->end()) throw std::out_of_range("no such element exists");
+  return *it;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+T &unordered_map<Key, T, Hash, KeyEqual, Allocator>::operator[](
+    const Key &key) {
+  iterator it = this->find(key);
+  return it != this->end() ? *it : *insert(key, mapped_type()).first;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(
+    const value_type &value) {
+  return this->insertSlot(value);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(const Key &key,
+                                                         const T &obj) {
+  return this->insertSlot(std::pair<const Key &, const T &>(key, obj));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert_or_assign(
+    const Key &key, const T &obj) {
+  std::pair<iterator, bool> result = insert(key, obj);
+  if (!result.second) *result.first = obj;
+  return result;
+}
+
+}  // namespace s21
+
+#endif
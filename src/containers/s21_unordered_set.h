@@ -0,0 +1,65 @@
+#ifndef __S21_CONTAINERS_UNORDERED_SET_H__
+#define __S21_CONTAINERS_UNORDERED_SET_H__
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+class unordered_set : public HashTable<Key, void, Hash, KeyEqual, Allocator> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const Key&;
+  using iterator =
+      typename HashTable<Key, void, Hash, KeyEqual, Allocator>::Iterator;
+  using const_iterator =
+      typename HashTable<Key, void, Hash, KeyEqual, Allocator>::ConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  unordered_set() : HashTable<Key, void, Hash, KeyEqual, Allocator>(){};
+  explicit unordered_set(const Allocator& alloc)
+      : HashTable<Key, void, Hash, KeyEqual, Allocator>(alloc){};
+  unordered_set(std::initializer_list<Key> const& items,
+                const Allocator& alloc = Allocator())
+      : unordered_set(items.begin(), items.end(), alloc){};
+  template <typename InputIt>
+  unordered_set(InputIt first, InputIt last,
+                const Allocator& alloc = Allocator())
+      : HashTable<Key, void, Hash, KeyEqual, Allocator>(alloc) {
+    for (; first != last; ++first) insert(*first);
+  };
+  unordered_set(const unordered_set& other)
+      : HashTable<Key, void, Hash, KeyEqual, Allocator>(other){};
+  unordered_set(unordered_set&& other)
+      : HashTable<Key, void, Hash, KeyEqual, Allocator>(std::move(other)){};
+  ~unordered_set() = default;
+  unordered_set& operator=(unordered_set&& s) {
+    HashTable<Key, void, Hash, KeyEqual, Allocator>::operator=(std::move(s));
+    return *this;
+  };
+
+  std::pair<iterator, bool> insert(const value_type& value);
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> ret;
+    (ret.push_back(insert(std::forward<Args>(args))), ...);
+    return ret;
+  }
+};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+unordered_set<Key, Hash, KeyEqual, Allocator>::insert(
+    const value_type& value) {
+  return this->insertSlot(value);
+}
+
+}  // namespace s21
+
+#endif
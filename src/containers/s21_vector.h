@@ -1,14 +1,16 @@
 #ifndef __S21_CONTAINERS_VECTOR_H__
 #define __S21_CONTAINERS_VECTOR_H__
 
+#include <algorithm>
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <utility>
 
 namespace s21 {
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class vector {
  public:
   // Vector member type
@@ -18,59 +20,75 @@ class vector {
   using iterator = T *;
   using const_iterator = const T *;
   using size_type = size_t;
+  using allocator_type = Allocator;
+
+ private:
+  using traits = std::allocator_traits<Allocator>;
 
  public:
   // Vector Member functions
-  vector() : size_(0), capacity_(5), arrPtr_(new value_type[capacity_]{}) {}
+  vector() : vector(Allocator()) {}
 
-  vector(size_type n) {
-    size_ = n;
-    capacity_ = n;
-    if (size_ > 0) {
-      arrPtr_ = new value_type[n]{};
-    }
+  explicit vector(const Allocator &alloc)
+      : allocator_(alloc), size_(0), capacity_(5), arrPtr_(allocate(5)) {}
+
+  vector(size_type n, const Allocator &alloc = Allocator())
+      : allocator_(alloc), size_(0), capacity_(n), arrPtr_(allocate(n)) {
+    for (; size_ < n; ++size_) traits::construct(allocator_, arrPtr_ + size_);
   }
 
-  vector(std::initializer_list<value_type> const &items)
-      : size_(items.size()),
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator())
+      : allocator_(alloc),
+        size_(0),
         capacity_(items.size()),
-        arrPtr_(new value_type[capacity_]{}) {
-    std::copy(items.begin(), items.end(), arrPtr_);
+        arrPtr_(allocate(capacity_)) {
+    for (const_reference item : items)
+      traits::construct(allocator_, arrPtr_ + size_++, item);
   }
 
   vector(const vector &v)
-      : size_(v.size_),
+      : allocator_(traits::select_on_container_copy_construction(v.allocator_)),
+        size_(0),
         capacity_(v.capacity_),
-        arrPtr_(new value_type[capacity_]{}) {
-    std::copy(v.begin(), v.end(), arrPtr_);
+        arrPtr_(allocate(capacity_)) {
+    for (const_reference item : v)
+      traits::construct(allocator_, arrPtr_ + size_++, item);
   }
 
   vector(vector &&v)
-      : size_(v.size_), capacity_(v.capacity_), arrPtr_(v.arrPtr_) {
+      : allocator_(std::move(v.allocator_)),
+        size_(v.size_),
+        capacity_(v.capacity_),
+        arrPtr_(v.arrPtr_) {
     v.size_ = 0;
     v.capacity_ = 0;
     v.arrPtr_ = nullptr;
   }
 
-  ~vector() {
-    if (arrPtr_) delete[] arrPtr_;
-  }
+  ~vector() { release(); }
 
   vector operator=(vector &&v) {
     if (this != &v) {
-      if (arrPtr_) {
-        delete[] arrPtr_;
+      release();
+      if constexpr (traits::propagate_on_container_move_assignment::value) {
+        allocator_ = std::move(v.allocator_);
+        steal(v);
+      } else if (allocator_ == v.allocator_) {
+        steal(v);
+      } else {
+        capacity_ = v.size_;
+        arrPtr_ = allocate(capacity_);
+        for (reference item : v)
+          traits::construct(allocator_, arrPtr_ + size_++, std::move(item));
+        v.clear();
       }
-      size_ = v.size_;
-      capacity_ = v.capacity_;
-      arrPtr_ = v.arrPtr_;
-      v.size_ = 0;
-      v.capacity_ = 0;
-      v.arrPtr_ = nullptr;
     }
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator_; }
+
   // Vector Element access
   reference at(size_type pos) {
     if (pos >= size_) {
@@ -111,51 +129,35 @@ class vector {
 
   void reserve(size_type size) {
     if (size > max_size()) {
-      std::length_error("Reserve Error: max size exceeded");
-    }
-    if (size > capacity_) {
-      iterator tmp = arrPtr_;
-      arrPtr_ = new value_type[size]{};
-      for (size_type i = 0; i < size_; ++i) {
-        arrPtr_[i] = tmp[i];
-      }
-      delete[] tmp;
-      capacity_ = size;
+      throw std::length_error("Reserve Error: max size exceeded");
     }
+    if (size > capacity_) reallocate(size);
   }
 
   size_type capacity() { return capacity_; }
 
   void shrink_to_fit() {
-    if (size_ < capacity_) {
-      iterator tmp = arrPtr_;
-      arrPtr_ = new value_type[size_]{};
-      for (size_type i = 0; i < size_; ++i) {
-        arrPtr_[i] = tmp[i];
-      }
-      delete[] tmp;
-      capacity_ = size_;
-    }
+    if (size_ < capacity_) reallocate(size_);
   }
 
   // Vector Modifiers
-  void clear() { size_ = 0; }
+  void clear() {
+    destroy(arrPtr_, arrPtr_ + size_);
+    size_ = 0;
+  }
 
   iterator insert(iterator pos, const_reference value) {
-    if (capacity_ == size_) {
-      size_type index = pos - begin();
-      reserve(capacity_ * 2);
-      pos = begin() + index;
-    }
-    value_type prev = value;
-    for (iterator it = pos; it <= end(); ++it) {
-      if (it < end()) {
-        value_type curr = *it;
-        *it = prev;
-        prev = curr;
-      } else {
-        *it = prev;
-      }
+    size_type index = pos - begin();
+    value_type copy = value;
+    if (capacity_ == size_) reallocate(grownCapacity());
+    pos = begin() + index;
+
+    if (pos == end()) {
+      traits::construct(allocator_, end(), std::move(copy));
+    } else {
+      traits::construct(allocator_, end(), std::move(*(end() - 1)));
+      std::move_backward(pos, end() - 1, end());
+      *pos = std::move(copy);
     }
     size_++;
     return pos;
@@ -163,26 +165,30 @@ class vector {
 
   void erase(iterator pos) {
     if (pos >= begin() && pos < end()) {
-      for (iterator it = pos; it < end() - 1; ++it) {
-        *it = *(it + 1);
-      }
+      std::move(pos + 1, end(), pos);
       size_--;
+      traits::destroy(allocator_, end());
     }
   }
 
   void push_back(const_reference value) {
     if (size_ == capacity_) {
-      reserve(capacity_ * 2);
+      value_type copy = value;
+      reallocate(grownCapacity());
+      traits::construct(allocator_, end(), std::move(copy));
+    } else {
+      traits::construct(allocator_, end(), value);
     }
-    arrPtr_[size_] = value;
     size_++;
   }
 
   void pop_back() {
-    if (size_) size_--;
+    if (size_) traits::destroy(allocator_, arrPtr_ + --size_);
   }
 
   void swap(vector &other) {
+    if constexpr (traits::propagate_on_container_swap::value)
+      std::swap(allocator_, other.allocator_);
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
     std::swap(arrPtr_, other.arrPtr_);
@@ -206,10 +212,49 @@ class vector {
   }
 
  private:
+  allocator_type allocator_;
   size_type size_;
   size_type capacity_;
   iterator arrPtr_;
+
+  iterator allocate(size_type n) {
+    return n > 0 ? traits::allocate(allocator_, n) : nullptr;
+  }
+
+  void destroy(iterator first, iterator last) {
+    for (; first != last; ++first) traits::destroy(allocator_, first);
+  }
+
+  void release() {
+    destroy(arrPtr_, arrPtr_ + size_);
+    if (arrPtr_) traits::deallocate(allocator_, arrPtr_, capacity_);
+    size_ = 0;
+    capacity_ = 0;
+    arrPtr_ = nullptr;
+  }
+
+  void steal(vector &v) {
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    arrPtr_ = v.arrPtr_;
+    v.size_ = 0;
+    v.capacity_ = 0;
+    v.arrPtr_ = nullptr;
+  }
+
+  size_type grownCapacity() { return capacity_ > 0 ? capacity_ * 2 : 1; }
+
+  void reallocate(size_type capacity) {
+    iterator tmp = allocate(capacity);
+    for (size_type i = 0; i < size_; ++i)
+      traits::construct(allocator_, tmp + i, std::move_if_noexcept(arrPtr_[i]));
+    size_type size = size_;
+    release();
+    size_ = size;
+    capacity_ = capacity;
+    arrPtr_ = tmp;
+  }
 };
 };  // namespace s21
 
-#endif  // __S21_CONTAINERS_VECTOR_H__
\ No newline at end of file
+#endif  // __S21_CONTAINERS_VECTOR_H__
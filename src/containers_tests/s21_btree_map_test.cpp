@@ -0,0 +1,100 @@
+#include <map>
+#include <string>
+
+#include "../s21_containers_test.h"
+
+// Counts live instances and copies and has no default constructor, so a node
+// must build exactly the slots it holds.
+class Live {
+ public:
+  static inline int count = 0;
+  static inline int copied = 0;
+
+  explicit Live(int value) : value_(value) { ++count; }
+  Live(const Live& other) : value_(other.value_) { ++count, ++copied; }
+  Live(Live&& other) noexcept : value_(other.value_) { ++count; }
+  ~Live() { --count; }
+  Live& operator=(const Live& other) = delete;
+  bool operator<(const Live& other) const { return value_ < other.value_; }
+  int value() const { return value_; }
+
+ private:
+  int value_;
+};
+
+TEST(btreeMap, constructorInitializer) {
+  s21::btree_map<int, char> mapMy{{3, 'c'}, {1, 'a'}, {2, 'b'}, {1, 'x'}};
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at(1), 'a');
+  EXPECT_EQ(*mapMy.begin(), 'a');
+  EXPECT_EQ(*--mapMy.end(), 'c');
+}
+
+TEST(btreeMap, elementAccess) {
+  s21::btree_map<std::string, int> mapMy;
+  mapMy["one"] = 1;
+  mapMy["two"] = 2;
+  ++mapMy["one"];
+
+  EXPECT_EQ(mapMy.at("one"), 2);
+  EXPECT_EQ(mapMy["three"], 0);
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_THROW(mapMy.at("four"), std::out_of_range);
+}
+
+TEST(btreeMap, insertOrAssign) {
+  s21::btree_map<int, std::string> mapMy;
+
+  EXPECT_TRUE(mapMy.insert(1, "a").second);
+  EXPECT_FALSE(mapMy.insert({1, "b"}).second);
+  EXPECT_EQ(mapMy.at(1), "a");
+  EXPECT_FALSE(mapMy.insert_or_assign(1, "c").second);
+  EXPECT_EQ(mapMy.at(1), "c");
+  EXPECT_TRUE(mapMy.insert_or_assign(2, "d").second);
+}
+
+TEST(btreeMap, matchesStdMap) {
+  s21::btree_map<int, int> mapMy;
+  std::map<int, int> mapBase;
+  for (int i = 0; i < 5000; ++i) {
+    int key = i * 31 % 2011;
+    mapMy[key] += i;
+    mapBase[key] += i;
+    if (i % 3 == 0 && mapMy.contains(key / 2)) {
+      mapMy.erase(mapMy.find(key / 2));
+      mapBase.erase(key / 2);
+    }
+  }
+
+  EXPECT_EQ(mapMy.size(), mapBase.size());
+  auto iterBase = mapBase.begin();
+  for (auto iterMy = mapMy.begin(); iterMy != mapMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, (iterBase++)->second);
+}
+
+TEST(btreeMap, noDefaultConstructor) {
+  {
+    s21::btree_map<Live, Live> mapMy;
+    mapMy.insert(Live(0), Live(0));
+    EXPECT_EQ(Live::count, 2);
+
+    for (int i = 1; i < 500; ++i) mapMy.insert(Live(i * 7 % 500), Live(i));
+    for (int i = 0; i < 500; i += 2) mapMy.erase(mapMy.find(Live(i)));
+    s21::btree_map<Live, Live> mapCopy(mapMy);
+    s21::btree_map<Live, Live> other;
+    other.insert(Live(1), Live(-1));
+    other.insert(Live(1000), Live(-1));
+    int copied = Live::copied;
+    mapMy.merge(other);
+
+    EXPECT_EQ(Live::copied, copied);
+    EXPECT_EQ(mapMy.size(), 251u);
+    EXPECT_EQ(other.size(), 1u);
+    EXPECT_EQ(mapMy.at(Live(1)).value(), 143);
+    EXPECT_EQ(mapMy.at(Live(1000)).value(), -1);
+    EXPECT_EQ(other.at(Live(1)).value(), -1);
+    EXPECT_EQ(Live::count, 2 * (251 + 1 + 250));
+  }
+  EXPECT_EQ(Live::count, 0);
+}
@@ -0,0 +1,52 @@
+#include <set>
+
+#include "../s21_containers_test.h"
+
+TEST(btreeMultiset, countAndBounds) {
+  s21::btree_multiset<int> s21Multiset;
+  std::multiset<int> stlMultiset;
+  for (int i = 0; i < 3000; ++i) {
+    s21Multiset.insert(i * 7 % 61);
+    stlMultiset.insert(i * 7 % 61);
+  }
+
+  for (int key = -1; key <= 62; ++key) {
+    EXPECT_EQ(s21Multiset.count(key), stlMultiset.count(key));
+    auto s21Iter = s21Multiset.upper_bound(key);
+    auto stlIter = stlMultiset.upper_bound(key);
+    EXPECT_EQ(s21Iter == s21Multiset.end(), stlIter == stlMultiset.end());
+    if (stlIter != stlMultiset.end()) {
+      EXPECT_EQ(*s21Iter, *stlIter);
+    }
+  }
+}
+
+TEST(btreeMultiset, equalRange) {
+  s21::btree_multiset<int> s21Multiset{0, 1, 2, 3, 3, 1, 6, 7, 6};
+  auto range = s21Multiset.equal_range(3);
+
+  int count = 0;
+  for (auto iter = range.first; iter != range.second; ++iter, ++count)
+    EXPECT_EQ(*iter, 3);
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(*range.second, 6);
+}
+
+TEST(btreeMultiset, eraseOneOfEqual) {
+  s21::btree_multiset<int> s21Multiset;
+  for (int i = 0; i < 1000; ++i) s21Multiset.insert(i % 10);
+
+  for (int i = 0; i < 50; ++i) s21Multiset.erase(s21Multiset.find(4));
+
+  EXPECT_EQ(s21Multiset.size(), 950u);
+  EXPECT_EQ(s21Multiset.count(4), 50u);
+  EXPECT_EQ(s21Multiset.count(5), 100u);
+}
+
+TEST(btreeMultiset, insertMany) {
+  s21::btree_multiset<int> s21Multiset;
+  s21Multiset.insert_many(2, 2, 1);
+
+  EXPECT_EQ(s21Multiset.size(), 3u);
+  EXPECT_EQ(*s21Multiset.begin(), 1);
+}
@@ -0,0 +1,131 @@
+#include <set>
+
+#include "../s21_containers_test.h"
+
+TEST(btreeSet, constructorInitializer) {
+  s21::btree_set<char> setMy{'b', 'a', 'c', 'a'};
+  std::set<char> setBase{'b', 'a', 'c', 'a'};
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+}
+
+TEST(btreeSet, emptyBeginIsEnd) {
+  s21::btree_set<int> setMy;
+
+  EXPECT_TRUE(setMy.empty());
+  EXPECT_TRUE(setMy.begin() == setMy.end());
+  EXPECT_TRUE(setMy.find(1) == setMy.end());
+}
+
+TEST(btreeSet, insertFindErase) {
+  s21::btree_set<int> setMy;
+  std::set<int> setBase;
+  for (int i = 0; i < 10007; ++i) {
+    int key = i * 7919 % 10007;
+    EXPECT_EQ(setMy.insert(key).second, setBase.insert(key).second);
+  }
+  EXPECT_FALSE(setMy.insert(42).second);
+
+  for (int key = 0; key < 10007; key += 3) {
+    auto iter = setMy.find(key);
+    ASSERT_TRUE(iter != setMy.end());
+    setMy.erase(iter);
+    setBase.erase(key);
+  }
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  EXPECT_FALSE(setMy.contains(3));
+  EXPECT_TRUE(setMy.contains(4));
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+}
+
+TEST(btreeSet, iterateBackwards) {
+  s21::btree_set<int> setMy;
+  for (int i = 0; i < 1000; ++i) setMy.insert(i);
+
+  int expected = 999;
+  auto iter = setMy.end();
+  while (iter != setMy.begin()) EXPECT_EQ(*--iter, expected--);
+  EXPECT_EQ(expected, -1);
+}
+
+TEST(btreeSet, bounds) {
+  s21::btree_set<int> setMy;
+  for (int i = 0; i < 500; ++i) setMy.insert(i * 2);
+
+  EXPECT_EQ(*setMy.lower_bound(100), 100);
+  EXPECT_EQ(*setMy.lower_bound(101), 102);
+  EXPECT_EQ(*setMy.upper_bound(100), 102);
+  EXPECT_TRUE(setMy.lower_bound(999) == setMy.end());
+  auto range = setMy.equal_range(7);
+  EXPECT_TRUE(range.first == range.second);
+}
+
+TEST(btreeSet, copyAndMove) {
+  s21::btree_set<std::string> setMy{"one", "two", "three"};
+  s21::btree_set<std::string> setCopy(setMy);
+  s21::btree_set<std::string> setMoved(std::move(setMy));
+
+  EXPECT_EQ(setCopy.size(), 3u);
+  EXPECT_EQ(setMoved.size(), 3u);
+  EXPECT_TRUE(setMy.empty());
+  EXPECT_EQ(*setCopy.begin(), "one");
+  setCopy.erase(setCopy.begin());
+  EXPECT_EQ(*setMoved.begin(), "one");
+}
+
+TEST(btreeSet, mergeLeavesDuplicates) {
+  s21::btree_set<int> setMy{1, 3, 5};
+  s21::btree_set<int> setMyForMerge{2, 3, 4, 5};
+  setMy.merge(setMyForMerge);
+
+  EXPECT_EQ(setMy.size(), 5u);
+  EXPECT_EQ(setMyForMerge.size(), 2u);
+  EXPECT_EQ(*setMyForMerge.begin(), 3);
+}
+
+TEST(btreeSet, swap) {
+  s21::btree_set<int> setMy{1, 2};
+  s21::btree_set<int> setOther{3};
+  setMy.swap(setOther);
+
+  EXPECT_EQ(setMy.size(), 1u);
+  EXPECT_EQ(*setMy.begin(), 3);
+  EXPECT_EQ(setOther.size(), 2u);
+}
+
+TEST(btreeSet, insertMany) {
+  s21::btree_set<int> setMy;
+  auto result = setMy.insert_many(3, 1, 3);
+
+  EXPECT_EQ(setMy.size(), 2u);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[2].second);
+}
+
+TEST(btreeSet, moveAssignPropagatingAllocator) {
+  CountingResource resource, other;
+  {
+    MovingAllocator<int> alloc(&resource), otherAlloc(&other);
+    s21::btree_set<int, MovingAllocator<int>> target(otherAlloc);
+    s21::btree_set<int, MovingAllocator<int>> source(alloc);
+    target.insert(-1);
+    for (int i = 0; i < 500; ++i) source.insert(i);
+    size_t allocations = resource.allocations;
+
+    target = std::move(source);
+
+    EXPECT_EQ(resource.allocations, allocations);
+    EXPECT_EQ(target.size(), 500u);
+    EXPECT_TRUE(target.contains(499));
+    EXPECT_FALSE(target.contains(-1));
+    EXPECT_TRUE(source.empty());
+  }
+  EXPECT_EQ(other.allocations, other.deallocations);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
@@ -0,0 +1,55 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+TEST(concurrentMap, insertAndAssign) {
+  s21::concurrent_map<int, std::string> mapMy{{2, "b"}, {1, "a"}};
+
+  EXPECT_EQ(mapMy.size(), 2u);
+  EXPECT_FALSE(mapMy.insert(1, "x").second);
+  EXPECT_EQ(mapMy.at(1), "a");
+  EXPECT_FALSE(mapMy.insert_or_assign(1, "x").second);
+  EXPECT_TRUE(mapMy.insert_or_assign(3, "c").second);
+  EXPECT_EQ(mapMy.at(1), "x");
+  EXPECT_THROW(mapMy.at(4), std::out_of_range);
+
+  std::string keys, values;
+  for (auto iter = mapMy.begin(); iter != mapMy.end(); ++iter) {
+    keys += std::to_string(iter.key());
+    values += *iter;
+  }
+  EXPECT_EQ(keys, "123");
+  EXPECT_EQ(values, "xbc");
+}
+
+TEST(concurrentMap, valueOutlivesAssign) {
+  s21::concurrent_map<int, std::string> mapMy{{1, "old"}};
+  auto iter = mapMy.find(1);
+  const std::string &seen = *iter;
+  mapMy.insert_or_assign(1, "new");
+
+  EXPECT_EQ(seen, "old");
+  EXPECT_EQ(*mapMy.find(1), "new");
+}
+
+TEST(concurrentMap, parallelAssignAndRead) {
+  s21::concurrent_map<int, std::string> mapMy;
+  for (int key = 0; key < 64; ++key) mapMy.insert(key, "0");
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t)
+    workers.emplace_back([&mapMy, t]() {
+      for (int i = 0; i < 2000; ++i) {
+        int key = (i * 7 + t) % 64;
+        if (t % 2)
+          mapMy.insert_or_assign(key, std::to_string(i));
+        else
+          EXPECT_FALSE(mapMy.at(key).empty());
+      }
+    });
+  for (std::thread &worker : workers) worker.join();
+
+  EXPECT_EQ(mapMy.size(), 64u);
+}
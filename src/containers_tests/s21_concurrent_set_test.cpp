@@ -0,0 +1,111 @@
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+TEST(concurrentSet, insertFindErase) {
+  s21::concurrent_set<int> setMy{5, 1, 3, 1};
+  std::set<int> setBase{5, 1, 3};
+
+  EXPECT_EQ(setMy.size(), 3u);
+  EXPECT_FALSE(setMy.insert(3).second);
+  EXPECT_TRUE(setMy.insert(4).second);
+  setBase.insert(4);
+  EXPECT_TRUE(setMy.contains(4));
+  EXPECT_TRUE(setMy.erase(1));
+  EXPECT_FALSE(setMy.erase(1));
+  setBase.erase(1);
+
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+  EXPECT_TRUE(iterBase == setBase.end());
+}
+
+TEST(concurrentSet, bounds) {
+  s21::concurrent_set<int> setMy;
+  for (int i = 0; i < 500; ++i) setMy.insert(i * 2);
+
+  EXPECT_EQ(*setMy.lower_bound(301), 302);
+  EXPECT_EQ(*setMy.lower_bound(302), 302);
+  EXPECT_EQ(*setMy.upper_bound(302), 304);
+  EXPECT_TRUE(setMy.lower_bound(999) == setMy.end());
+  EXPECT_TRUE(setMy.find(301) == setMy.end());
+}
+
+TEST(concurrentSet, iteratorSurvivesErase) {
+  s21::concurrent_set<int> setMy{1, 2, 3, 4};
+  auto iter = setMy.find(2);
+  setMy.erase(2);
+  setMy.erase(3);
+
+  EXPECT_EQ(*iter, 2);
+  ++iter;
+  EXPECT_EQ(*iter, 4);
+  EXPECT_FALSE(setMy.contains(2));
+}
+
+TEST(concurrentSet, clear) {
+  s21::concurrent_set<int> setMy;
+  for (int i = 0; i < 1000; ++i) setMy.insert(i);
+  setMy.clear();
+
+  EXPECT_TRUE(setMy.empty());
+  EXPECT_EQ(setMy.size(), 0u);
+}
+
+TEST(concurrentSet, parallelInsertDisjoint) {
+  const int threads = 8, perThread = 4000;
+  s21::concurrent_set<int> setMy;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&setMy, t]() {
+      for (int i = 0; i < perThread; ++i) setMy.insert(i * threads + t);
+    });
+  for (std::thread &worker : workers) worker.join();
+
+  EXPECT_EQ(setMy.size(), static_cast<size_t>(threads * perThread));
+  int expected = 0;
+  for (auto iter = setMy.begin(); iter != setMy.end(); ++iter)
+    EXPECT_EQ(*iter, expected++);
+  EXPECT_EQ(expected, threads * perThread);
+}
+
+TEST(concurrentSet, scansWhileWritersRun) {
+  const int keys = 2000;
+  s21::concurrent_set<int> setMy;
+  for (int i = 0; i < keys; i += 2) setMy.insert(i);
+
+  std::atomic<bool> done(false);
+  std::atomic<int> badScans(0);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 3; ++t)
+    workers.emplace_back([&setMy, t]() {
+      for (int round = 0; round < 20; ++round)
+        for (int i = t; i < keys; i += 3) {
+          if (i % 2) {
+            setMy.insert(i);
+            setMy.erase(i);
+          }
+        }
+    });
+  std::thread scanner([&]() {
+    while (!done.load()) {
+      int previous = -1, evens = 0;
+      for (auto iter = setMy.lower_bound(0); iter != setMy.end(); ++iter) {
+        if (*iter <= previous) badScans++;
+        if (*iter % 2 == 0) ++evens;
+        previous = *iter;
+      }
+      if (evens != keys / 2) badScans++;
+    }
+  });
+  for (std::thread &worker : workers) worker.join();
+  done = true;
+  scanner.join();
+
+  EXPECT_EQ(badScans.load(), 0);
+  EXPECT_EQ(setMy.size(), static_cast<size_t>(keys / 2));
+}
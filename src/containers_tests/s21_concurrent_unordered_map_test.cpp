@@ -0,0 +1,86 @@
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+TEST(concurrentUnorderedMap, singleThreadedApi) {
+  s21::concurrent_unordered_map<int, std::string> mapMy{{1, "a"}, {2, "b"}};
+  std::string value;
+
+  EXPECT_EQ(mapMy.size(), 2u);
+  EXPECT_TRUE(mapMy.find(1, value));
+  EXPECT_EQ(value, "a");
+  EXPECT_FALSE(mapMy.find(3, value));
+  EXPECT_FALSE(mapMy.insert(1, "x"));
+  EXPECT_FALSE(mapMy.insert_or_assign(1, "x"));
+  EXPECT_TRUE(mapMy.insert_or_assign(3, "c"));
+  EXPECT_TRUE(mapMy.find(1, value));
+  EXPECT_EQ(value, "x");
+  EXPECT_TRUE(mapMy.erase(2));
+  EXPECT_FALSE(mapMy.erase(2));
+  EXPECT_FALSE(mapMy.contains(2));
+  EXPECT_EQ(mapMy.size(), 2u);
+  mapMy.clear();
+  EXPECT_TRUE(mapMy.empty());
+}
+
+TEST(concurrentUnorderedMap, shardCountIsPowerOfTwo) {
+  s21::concurrent_unordered_map<int, int> mapMy(5);
+
+  EXPECT_EQ(mapMy.shard_count(), 8u);
+}
+
+TEST(concurrentUnorderedMap, updateInsertsAndModifies) {
+  s21::concurrent_unordered_map<std::string, int> mapMy;
+
+  EXPECT_TRUE(mapMy.update("a", [](int &count) { count += 2; }));
+  EXPECT_FALSE(mapMy.update("a", [](int &count) { count *= 5; }));
+  int value = 0;
+  EXPECT_TRUE(mapMy.find("a", value));
+  EXPECT_EQ(value, 10);
+}
+
+TEST(concurrentUnorderedMap, forEachVisitsEverything) {
+  s21::concurrent_unordered_map<int, int> mapMy(4);
+  std::map<int, int> mapBase;
+  for (int i = 0; i < 1000; ++i) {
+    mapMy.insert(i, i * i);
+    mapBase[i] = i * i;
+  }
+
+  std::map<int, int> collected;
+  mapMy.for_each([&collected](const int &key, const int &value) {
+    collected[key] = value;
+  });
+  EXPECT_TRUE(collected == mapBase);
+}
+
+TEST(concurrentUnorderedMap, parallelWritersAndReaders) {
+  const int threads = 8, perThread = 5000;
+  s21::concurrent_unordered_map<int, int> mapMy;
+  mapMy.reserve(threads * perThread);
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&mapMy, t]() {
+      for (int i = 0; i < perThread; ++i) {
+        mapMy.insert(t * perThread + i, i);
+        mapMy.update(-1 - i % 100, [](int &count) { ++count; });
+        int value;
+        mapMy.find((t + 1) % threads * perThread + i, value);
+      }
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+
+  EXPECT_EQ(mapMy.size(), static_cast<size_t>(threads * perThread + 100));
+  int total = 0;
+  for (int key = -100; key < 0; ++key) {
+    int value = 0;
+    EXPECT_TRUE(mapMy.find(key, value));
+    total += value;
+  }
+  EXPECT_EQ(total, threads * perThread);
+}
@@ -0,0 +1,76 @@
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+TEST(flatMap, constructorInitializer) {
+  s21::flat_map<int, std::string> mapMy{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at(1), "a");
+  EXPECT_EQ(mapMy.at(3), "c");
+  EXPECT_THROW(mapMy.at(4), std::out_of_range);
+}
+
+TEST(flatMap, keysAndValuesStayAligned) {
+  s21::flat_map<int, int> mapMy;
+  std::map<int, int> mapBase;
+  for (int i = 0; i < 2003; ++i) {
+    int key = i * 1009 % 2003;
+    mapMy.insert(key, key * 10);
+    mapBase.insert({key, key * 10});
+  }
+  for (int key = 0; key < 2003; key += 5) {
+    mapMy.erase(mapMy.find(key));
+    mapBase.erase(key);
+  }
+
+  EXPECT_EQ(mapMy.size(), mapBase.size());
+  auto iterBase = mapBase.begin();
+  for (auto iterMy = mapMy.begin(); iterMy != mapMy.end(); ++iterMy) {
+    EXPECT_EQ(mapMy.key_at(iterMy), iterBase->first);
+    EXPECT_EQ(*iterMy, iterBase++->second);
+  }
+}
+
+TEST(flatMap, batchInsertKeepsFirst) {
+  s21::flat_map<int, char> mapMy{{2, 'b'}, {4, 'd'}};
+  std::vector<std::pair<int, char>> batch{
+      {3, 'c'}, {4, 'x'}, {1, 'a'}, {3, 'y'}};
+  mapMy.insert(batch.begin(), batch.end());
+
+  EXPECT_EQ(mapMy.size(), 4u);
+  EXPECT_EQ(mapMy[1], 'a');
+  EXPECT_EQ(mapMy[3], 'c');
+  EXPECT_EQ(mapMy[4], 'd');
+  std::string values(mapMy.begin(), mapMy.end());
+  EXPECT_EQ(values, "abcd");
+}
+
+TEST(flatMap, subscriptAndAssign) {
+  s21::flat_map<std::string, int> mapMy;
+  mapMy["b"] = 2;
+  mapMy["a"] = 1;
+  ++mapMy["b"];
+  EXPECT_FALSE(mapMy.insert_or_assign("a", 5).second);
+  EXPECT_TRUE(mapMy.insert_or_assign("c", 7).second);
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at("a"), 5);
+  EXPECT_EQ(mapMy.at("b"), 3);
+  EXPECT_EQ(mapMy.at("c"), 7);
+  EXPECT_EQ(*mapMy.lower_bound("bb"), 7);
+}
+
+TEST(flatMap, mergeLeavesDuplicates) {
+  s21::flat_map<int, int> mapMy{{1, 10}, {2, 20}};
+  s21::flat_map<int, int> other{{2, 200}, {3, 300}};
+  mapMy.merge(other);
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at(2), 20);
+  EXPECT_EQ(mapMy.at(3), 300);
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.at(2), 200);
+}
@@ -0,0 +1,40 @@
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+TEST(flatMultiset, insertAndCount) {
+  s21::flat_multiset<int> setMy{3, 1, 3, 2, 3};
+  std::multiset<int> setBase{3, 1, 3, 2, 3};
+  setMy.insert(2);
+  setBase.insert(2);
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  EXPECT_EQ(setMy.count(3), 3u);
+  EXPECT_EQ(setMy.count(2), 2u);
+  EXPECT_EQ(setMy.count(4), 0u);
+  EXPECT_TRUE(std::equal(setMy.begin(), setMy.end(), setBase.begin()));
+}
+
+TEST(flatMultiset, batchInsertKeepsDuplicates) {
+  s21::flat_multiset<int> setMy{5, 1};
+  std::vector<int> batch{5, 3, 1, 5};
+  setMy.insert(batch.begin(), batch.end());
+
+  std::multiset<int> setBase{5, 1, 5, 3, 1, 5};
+  EXPECT_EQ(setMy.size(), setBase.size());
+  EXPECT_TRUE(std::equal(setMy.begin(), setMy.end(), setBase.begin()));
+  auto range = setMy.equal_range(5);
+  EXPECT_EQ(range.second - range.first, 3);
+}
+
+TEST(flatMultiset, mergeTakesEverything) {
+  s21::flat_multiset<int> setMy{1, 2};
+  s21::flat_multiset<int> other{2, 3};
+  setMy.merge(other);
+
+  EXPECT_EQ(setMy.size(), 4u);
+  EXPECT_EQ(setMy.count(2), 2u);
+  EXPECT_TRUE(other.empty());
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+TEST(flatSet, constructorInitializer) {
+  s21::flat_set<char> setMy{'b', 'a', 'c', 'a'};
+  std::set<char> setBase{'b', 'a', 'c', 'a'};
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+}
+
+TEST(flatSet, insertFindErase) {
+  s21::flat_set<int> setMy;
+  std::set<int> setBase;
+  for (int i = 0; i < 2003; ++i) {
+    int key = i * 1009 % 2003;
+    EXPECT_EQ(setMy.insert(key).second, setBase.insert(key).second);
+  }
+  EXPECT_FALSE(setMy.insert(42).second);
+
+  for (int key = 0; key < 2003; key += 3) {
+    auto iter = setMy.find(key);
+    ASSERT_TRUE(iter != setMy.end());
+    setMy.erase(iter);
+    setBase.erase(key);
+  }
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  EXPECT_FALSE(setMy.contains(3));
+  EXPECT_TRUE(setMy.contains(4));
+  EXPECT_TRUE(std::equal(setMy.begin(), setMy.end(), setBase.begin()));
+}
+
+TEST(flatSet, batchInsertMerges) {
+  s21::flat_set<int> setMy{10, 20, 30};
+  std::vector<int> batch{25, 5, 20, 35, 5, 15};
+  setMy.insert(batch.begin(), batch.end());
+
+  std::set<int> setBase{10, 20, 30, 25, 5, 35, 15};
+  EXPECT_EQ(setMy.size(), setBase.size());
+  EXPECT_TRUE(std::equal(setMy.begin(), setMy.end(), setBase.begin()));
+}
+
+TEST(flatSet, batchInsertLarge) {
+  std::vector<int> keys;
+  for (int i = 0; i < 50000; ++i) keys.push_back(i * 7919 % 50021);
+  s21::flat_set<int> setMy(keys.begin(), keys.end());
+  std::set<int> setBase(keys.begin(), keys.end());
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  EXPECT_TRUE(std::equal(setMy.begin(), setMy.end(), setBase.begin()));
+}
+
+TEST(flatSet, bounds) {
+  s21::flat_set<int> setMy{0, 2, 4, 6, 8};
+
+  EXPECT_EQ(*setMy.lower_bound(3), 4);
+  EXPECT_EQ(*setMy.lower_bound(4), 4);
+  EXPECT_EQ(*setMy.upper_bound(4), 6);
+  EXPECT_TRUE(setMy.lower_bound(9) == setMy.end());
+  auto range = setMy.equal_range(6);
+  EXPECT_EQ(range.second - range.first, 1);
+  range = setMy.equal_range(5);
+  EXPECT_TRUE(range.first == range.second);
+}
+
+TEST(flatSet, mergeLeavesDuplicates) {
+  s21::flat_set<int> setMy{1, 3, 5};
+  s21::flat_set<int> other{2, 3, 4, 5};
+  setMy.merge(other);
+
+  EXPECT_EQ(setMy.size(), 5u);
+  EXPECT_EQ(other.size(), 2u);
+  EXPECT_TRUE(other.contains(3));
+  EXPECT_TRUE(other.contains(5));
+}
+
+TEST(flatSet, copyAndSwap) {
+  s21::flat_set<std::string> setMy{"b", "a"};
+  s21::flat_set<std::string> setCopy(setMy);
+  s21::flat_set<std::string> setOther{"c"};
+  setCopy.swap(setOther);
+
+  EXPECT_EQ(setCopy.size(), 1u);
+  EXPECT_EQ(setOther.size(), 2u);
+  EXPECT_EQ(*setOther.begin(), "a");
+  EXPECT_EQ(setMy.size(), 2u);
+}
+
+TEST(flatSet, pmrAllocator) {
+  CountingResource resource;
+  {
+    s21::flat_set<int, std::pmr::polymorphic_allocator<int>> setMy(&resource);
+    for (int i = 0; i < 100; ++i) setMy.insert(i);
+    EXPECT_EQ(setMy.size(), 100u);
+    EXPECT_TRUE(setMy.get_allocator().resource() == &resource);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
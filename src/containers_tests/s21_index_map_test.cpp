@@ -0,0 +1,39 @@
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "../s21_containers_test.h"
+
+TEST(indexMap, reusedSlotStartsFresh) {
+  s21::index_map<int, std::string> mapMy;
+  mapMy[1] = "one";
+  mapMy[2] = "two";
+  mapMy.erase(mapMy.find(1));
+
+  EXPECT_EQ(mapMy[3], "");
+  mapMy.insert(4, "four");
+  EXPECT_EQ(mapMy.at(4), "four");
+  EXPECT_EQ(mapMy.at(2), "two");
+  EXPECT_FALSE(mapMy.contains(1));
+}
+
+TEST(indexMap, maxSize) {
+  s21::index_map<int, std::string> mapMy;
+
+  EXPECT_EQ(mapMy.max_size(), std::numeric_limits<uint32_t>::max() / 2 - 1);
+}
+
+TEST(indexMap, iteratorsSurviveReallocation) {
+  CountingResource resource;
+  s21::index_map<int, int, std::pmr::polymorphic_allocator<int>> mapMy(
+      &resource);
+  auto first = mapMy.insert(0, 0).first;
+  size_t allocations = resource.allocations;
+  for (int i = 1; i < 5000; ++i) mapMy.insert(i, i);
+
+  EXPECT_GT(resource.allocations, allocations + 5);
+  *first = -1;
+  EXPECT_EQ(mapMy.at(0), -1);
+  EXPECT_EQ(first.key(), 0);
+  EXPECT_EQ(*++first, 1);
+}
@@ -0,0 +1,71 @@
+#include <random>
+#include <set>
+
+#include "../s21_containers_test.h"
+
+// Ordered by key alone, so the tag tells equal keys apart.
+struct TaggedKey {
+  int key, tag;
+
+  bool operator<(const TaggedKey& other) const { return key < other.key; }
+};
+
+TEST(indexMultiset, randomChurnReusesFreeSlots) {
+  CountingResource resource;
+  s21::index_multiset<int, std::pmr::polymorphic_allocator<int>> setMy(
+      &resource);
+  std::multiset<int> setBase;
+  std::mt19937 random(20);
+  std::uniform_int_distribution<int> keys(0, 63);
+  for (int i = 0; i < 1000; ++i) {
+    int key = keys(random);
+    setMy.insert(key);
+    setBase.insert(key);
+  }
+  size_t allocations = resource.allocations;
+
+  for (int i = 0; i < 20000; ++i) {
+    auto iterMy = setMy.lower_bound(keys(random));
+    if (iterMy == setMy.end()) iterMy = setMy.begin();
+    setBase.erase(setBase.find(*iterMy));
+    setMy.erase(iterMy);
+    int key = keys(random);
+    setMy.insert(key);
+    setBase.insert(key);
+  }
+
+  EXPECT_EQ(resource.allocations, allocations);
+  EXPECT_EQ(setMy.size(), setBase.size());
+  for (int key = 0; key < 64; ++key)
+    EXPECT_EQ(setMy.count(key), setBase.count(key));
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+}
+
+TEST(indexMultiset, equalKeysKeepInsertionOrder) {
+  s21::index_multiset<TaggedKey> setMy;
+  int tag = 0;
+  for (int i = 0; i < 300; ++i) setMy.insert({i % 3, tag++});
+  // Free the low slots so later equal keys land before older ones in the
+  // node array.
+  for (int i = 0; i < 30; ++i) setMy.erase(setMy.begin());
+  for (int i = 0; i < 90; ++i) setMy.insert({i % 3, tag++});
+
+  for (int key = 0; key < 3; ++key) {
+    auto range = setMy.equal_range({key, 0});
+    int last = -1;
+    for (auto iter = range.first; iter != range.second; ++iter) {
+      EXPECT_GT((*iter).tag, last);
+      last = (*iter).tag;
+    }
+  }
+  EXPECT_EQ(setMy.count({0, 0}), 100u);
+  EXPECT_EQ(setMy.count({1, 0}), 130u);
+}
+
+TEST(indexMultiset, maxSize) {
+  s21::index_multiset<int> setMy{1, 1};
+
+  EXPECT_EQ(setMy.max_size(), s21::index_set<int>().max_size());
+}
@@ -0,0 +1,90 @@
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+using PmrIndexSet =
+    s21::index_set<int, std::pmr::polymorphic_allocator<int>>;
+
+TEST(indexSet, randomChurnReusesFreeSlots) {
+  CountingResource resource;
+  PmrIndexSet setMy(&resource);
+  std::set<int> setBase;
+  std::mt19937 random(20);
+  std::uniform_int_distribution<int> keys(0, 9999);
+  while (setBase.size() < 1000) {
+    int key = keys(random);
+    EXPECT_EQ(setMy.insert(key).second, setBase.insert(key).second);
+  }
+  size_t allocations = resource.allocations;
+
+  for (int i = 0; i < 20000; ++i) {
+    int key = keys(random);
+    auto iterMy = setMy.lower_bound(key);
+    if (iterMy == setMy.end()) iterMy = setMy.begin();
+    setBase.erase(*iterMy);
+    setMy.erase(iterMy);
+    for (bool inserted = false; !inserted;) {
+      key = keys(random);
+      inserted = setMy.insert(key).second;
+      EXPECT_EQ(inserted, setBase.insert(key).second);
+    }
+  }
+
+  EXPECT_EQ(resource.allocations, allocations);
+  EXPECT_EQ(setMy.size(), setBase.size());
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+}
+
+TEST(indexSet, copyKeepsFreeList) {
+  s21::index_set<int> setMy;
+  for (int i = 0; i < 1000; ++i) setMy.insert(i);
+  for (int i = 0; i < 1000; i += 2) setMy.erase(setMy.find(i));
+  s21::index_set<int> setCopy(setMy);
+  for (int i = 1000; i < 1500; ++i) setCopy.insert(i);
+
+  EXPECT_EQ(setCopy.size(), 1000u);
+  EXPECT_EQ(*setCopy.begin(), 1);
+  EXPECT_EQ(*--setCopy.end(), 1499);
+  EXPECT_EQ(setMy.size(), 500u);
+  EXPECT_FALSE(setMy.contains(1000));
+}
+
+TEST(indexSet, maxSize) {
+  s21::index_set<int> setMy;
+  size_t limit = std::numeric_limits<uint32_t>::max() / 2 - 1;
+
+  EXPECT_EQ(setMy.max_size(), limit);
+  setMy.insert(1);
+  EXPECT_EQ(setMy.max_size(), limit);
+}
+
+TEST(indexSet, iteratorsSurviveReallocation) {
+  CountingResource resource;
+  PmrIndexSet setMy(&resource);
+  std::vector<PmrIndexSet::iterator> iters;
+  int reallocations = 0;
+  for (int i = 0; i < 5000; ++i) {
+    size_t allocations = resource.allocations;
+    iters.push_back(setMy.insert(i * 7919 % 5003).first);
+    if (resource.allocations == allocations) continue;
+    ++reallocations;
+    for (int j = 0; j <= i; ++j) ASSERT_EQ(*iters[j], j * 7919 % 5003);
+  }
+
+  EXPECT_GT(reallocations, 5);
+  auto iter = iters[0];
+  EXPECT_EQ(*iter, 0);
+  EXPECT_EQ(*++iter, 1);
+}
+
+TEST(indexSet, compactNodeSize) {
+  using Node = s21::IndexTree<int, void, std::allocator<int>, false>::Node;
+
+  EXPECT_EQ(sizeof(Node), 16u);
+}
@@ -264,4 +264,19 @@ TEST(list, insertManyFront) {
     EXPECT_EQ(*it1, *it2);
     ++it1, ++it2;
   }
-}
\ No newline at end of file
+}
+TEST(List, PolymorphicAllocator) {
+  CountingResource resource;
+  {
+    using Alloc = std::pmr::polymorphic_allocator<int>;
+    s21::list<int, Alloc> list({5, 3, 4, 1, 2}, Alloc(&resource));
+    list.sort();
+    list.push_front(0);
+
+    int expected = 0;
+    for (int value : list) EXPECT_EQ(value, expected++);
+    EXPECT_EQ(expected, 6);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
@@ -1,4 +1,9 @@
+#include <cstdio>
 #include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 
 #include "../s21_containers_test.h"
 
@@ -19,6 +24,41 @@ class Point {
   double x_, y_;
 };
 
+// Has neither a default constructor nor an assignment.
+class NoDefault {
+ public:
+  explicit NoDefault(int value) : value_(value) {}
+  NoDefault(const NoDefault& other) = default;
+  NoDefault& operator=(const NoDefault& other) = delete;
+  bool operator<(const NoDefault& other) const {
+    return value_ < other.value_;
+  }
+  int value() const { return value_; }
+
+ private:
+  int value_;
+};
+
+// Counts how often values are built, to check what emplace constructs.
+class Tracked {
+ public:
+  static inline int constructed = 0;
+  static inline int copied = 0;
+
+  Tracked(int value = 0) : value_(value) { ++constructed; }
+  Tracked(const Tracked& other) : value_(other.value_) { ++copied; }
+  Tracked(Tracked&& other) noexcept : value_(other.value_) {}
+  Tracked& operator=(const Tracked& other) {
+    value_ = other.value_;
+    ++copied;
+    return *this;
+  }
+  int value() const { return value_; }
+
+ private:
+  int value_;
+};
+
 TEST(map, defaultConstructor) {
   s21::map<int, int> s21IntIntMap;
   s21::map<int, char> s21IntCharMap;
@@ -320,4 +360,309 @@ TEST(map, insertMany) {
   auto s21IterEnd = s21Map.end();
   for (; s21Iter != s21IterEnd; ++s21Iter, ++stlIter)
     EXPECT_EQ(*s21Iter, (*stlIter).second);
-}
\ No newline at end of file
+}
+
+TEST(map, nth) {
+  s21::map<int, char> s21Map{{3, 'c'}, {1, 'a'}, {4, 'd'}, {2, 'b'}};
+  std::map<int, char> stlMap{{3, 'c'}, {1, 'a'}, {4, 'd'}, {2, 'b'}};
+
+  auto stlIter = stlMap.begin();
+  for (size_t k = 0; k < stlMap.size(); ++k, ++stlIter)
+    EXPECT_EQ(*s21Map.nth(k), (*stlIter).second);
+  EXPECT_TRUE(s21Map.nth(4) == s21Map.end());
+}
+
+TEST(map, rank) {
+  s21::map<int, char> s21Map{{3, 'c'}, {1, 'a'}, {4, 'd'}, {2, 'b'}};
+
+  EXPECT_EQ(s21Map.rank(0), 0);
+  EXPECT_EQ(s21Map.rank(3), 2);
+  EXPECT_EQ(s21Map.rank(5), 4);
+  s21Map.erase(s21Map.find(1));
+  EXPECT_EQ(s21Map.rank(3), 1);
+  EXPECT_EQ(s21Map.size(), 3);
+}
+
+TEST(map, polymorphicAllocator) {
+  CountingResource resource;
+  {
+    using Alloc = std::pmr::polymorphic_allocator<std::pair<const int, int>>;
+    s21::map<int, int, Alloc> map({{1, 10}, {2, 20}}, Alloc(&resource));
+    map[3] = 30;
+    map.insert_or_assign(1, 11);
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.at(1), 11);
+    EXPECT_EQ(map.at(3), 30);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
+
+TEST(map, bounds) {
+  s21::map<int, char> mapMy{{1, 'a'}, {3, 'c'}, {5, 'e'}};
+
+  EXPECT_EQ(*mapMy.lower_bound(3), 'c');
+  EXPECT_EQ(*mapMy.upper_bound(3), 'e');
+  EXPECT_EQ(*mapMy.lower_bound(2), 'c');
+  EXPECT_TRUE(mapMy.upper_bound(5) == mapMy.end());
+
+  auto range = mapMy.equal_range(1);
+  EXPECT_EQ(*range.first, 'a');
+  EXPECT_EQ(*range.second, 'c');
+}
+
+TEST(map, rangeConstructor) {
+  std::map<int, char> mapBase{{3, 'c'}, {1, 'a'}, {2, 'b'}};
+  s21::map<int, char> mapMy(mapBase.begin(), mapBase.end());
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at(1), 'a');
+  EXPECT_EQ(mapMy.at(3), 'c');
+
+  s21::map<int, char> duplicates{{2, 'x'}, {1, 'a'}, {2, 'y'}};
+  EXPECT_EQ(duplicates.size(), 2u);
+  EXPECT_EQ(duplicates.at(2), 'x');
+}
+
+TEST(map, mergeLeavesDuplicates) {
+  s21::map<int, char> mapMy{{1, 'a'}, {2, 'b'}};
+  s21::map<int, char> mapForMerge{{2, 'x'}, {3, 'c'}};
+  mapMy.merge(mapForMerge);
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at(2), 'b');
+  EXPECT_EQ(mapMy.at(3), 'c');
+  EXPECT_EQ(mapForMerge.size(), 1u);
+  EXPECT_EQ(mapForMerge.at(2), 'x');
+}
+
+TEST(map, extractRekeys) {
+  s21::map<int, std::string> mapMy{{1, "one"}, {2, "two"}};
+
+  auto nh = mapMy.extract(mapMy.find(1));
+  nh.key() = 3;
+  nh.mapped() += "!";
+  auto result = mapMy.insert(std::move(nh));
+
+  EXPECT_TRUE(result.inserted);
+  EXPECT_FALSE(mapMy.contains(1));
+  EXPECT_EQ(mapMy.at(3), "one!");
+  EXPECT_EQ(mapMy.size(), 2u);
+}
+
+TEST(map, unionKeepsOwnValues) {
+  s21::map<int, char> mapMy{{1, 'a'}, {2, 'b'}};
+  s21::map<int, char> mapOther{{2, 'x'}, {3, 'c'}};
+
+  mapMy.set_union(mapOther);
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at(2), 'b');
+  EXPECT_EQ(mapMy.at(3), 'c');
+  EXPECT_EQ(mapOther.size(), 2u);
+}
+
+TEST(map, tryEmplaceBuildsOnlyNewValues) {
+  s21::map<int, Tracked> mapMy;
+  Tracked::constructed = Tracked::copied = 0;
+
+  EXPECT_TRUE(mapMy.try_emplace(1, 10).second);
+  EXPECT_FALSE(mapMy.try_emplace(1, 20).second);
+  EXPECT_FALSE(mapMy.emplace(1, 30).second);
+  EXPECT_TRUE(mapMy.emplace(2, 40).second);
+
+  EXPECT_EQ(Tracked::constructed, 2);
+  EXPECT_EQ(Tracked::copied, 0);
+  EXPECT_EQ(mapMy.at(1).value(), 10);
+  EXPECT_EQ(mapMy.at(2).value(), 40);
+}
+
+TEST(map, noDefaultConstructor) {
+  s21::map<NoDefault, NoDefault> mapMy;
+
+  EXPECT_TRUE(mapMy.emplace(NoDefault(2), NoDefault(20)).second);
+  EXPECT_TRUE(mapMy.try_emplace(NoDefault(1), 10).second);
+  EXPECT_TRUE(mapMy.try_emplace(mapMy.end(), NoDefault(3), 30) !=
+              mapMy.end());
+  EXPECT_FALSE(mapMy.emplace(NoDefault(1), NoDefault(11)).second);
+  mapMy.erase(mapMy.find(NoDefault(2)));
+  s21::map<NoDefault, NoDefault> mapCopy(mapMy);
+
+  EXPECT_EQ(mapCopy.size(), 2u);
+  EXPECT_EQ(mapMy.at(NoDefault(1)).value(), 10);
+  EXPECT_EQ((*mapCopy.begin()).value(), 10);
+  EXPECT_EQ((*--mapCopy.end()).value(), 30);
+  EXPECT_TRUE(mapMy.find(NoDefault(2)) == mapMy.end());
+}
+
+TEST(map, emplaceForms) {
+  s21::map<std::string, std::string> mapMy;
+
+  EXPECT_TRUE(mapMy.emplace("a", "xxx").second);
+  EXPECT_TRUE(mapMy.emplace(std::make_pair("b", "y")).second);
+  EXPECT_TRUE(mapMy
+                  .emplace(std::piecewise_construct, std::forward_as_tuple("c"),
+                           std::forward_as_tuple(2, 'z'))
+                  .second);
+  auto iter = mapMy.emplace_hint(mapMy.end(), "d", "w");
+  std::string key = "e";
+  EXPECT_TRUE(mapMy.try_emplace(std::move(key), "v").second);
+
+  EXPECT_EQ(mapMy.size(), 5u);
+  EXPECT_EQ(*iter, "w");
+  EXPECT_EQ(mapMy.at("a"), "xxx");
+  EXPECT_EQ(mapMy.at("b"), "y");
+  EXPECT_EQ(mapMy.at("c"), "zz");
+  EXPECT_EQ(mapMy.at("e"), "v");
+}
+
+TEST(map, insertMovesValue) {
+  s21::map<int, std::unique_ptr<int>> mapMy;
+
+  EXPECT_TRUE(mapMy.insert({1, std::make_unique<int>(5)}).second);
+  EXPECT_TRUE(mapMy.try_emplace(2, new int(6)).second);
+  auto owned = std::make_unique<int>(7);
+  EXPECT_FALSE(mapMy.try_emplace(2, std::move(owned)).second);
+
+  EXPECT_TRUE(owned != nullptr);
+  EXPECT_EQ(*mapMy.at(1), 5);
+  EXPECT_EQ(*mapMy.at(2), 6);
+}
+
+TEST(map, assignInPlace) {
+  CountingResource resource;
+  using Alloc = std::pmr::polymorphic_allocator<std::pair<const int, int>>;
+  s21::map<int, int, Alloc> mapMy({{1, 10}, {2, 20}}, Alloc(&resource));
+  auto iter = mapMy.find(1);
+  size_t allocations = resource.allocations;
+
+  EXPECT_FALSE(mapMy.insert_or_assign(1, 11).second);
+  mapMy[2] += 5;
+  mapMy.at(2) *= 2;
+
+  EXPECT_EQ(resource.allocations, allocations);
+  EXPECT_EQ(*iter, 11);
+  EXPECT_EQ(mapMy.at(2), 50);
+  EXPECT_EQ(mapMy[3], 0);
+  EXPECT_EQ(mapMy.size(), 3u);
+}
+
+TEST(map, compactNodeSize) {
+  if (sizeof(void*) == 8) {
+    EXPECT_LE(sizeof(s21::map<int, int>::Node), 40u);
+    EXPECT_LE(sizeof(s21::map<int, double>::Node), 48u);
+    EXPECT_LE(sizeof(s21::map<std::string, std::string>::Node),
+              2 * sizeof(std::string) + 32);
+  }
+}
+
+TEST(map, hintedInsert) {
+  s21::map<int, int> mapMy;
+  std::map<int, int> mapBase;
+  for (int i = 0; i < 1000; ++i) {
+    mapMy.insert(mapMy.end(), {i * 2, i});
+    mapBase.insert(mapBase.end(), {i * 2, i});
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    auto hint = mapMy.find(i * 2);
+    EXPECT_EQ(*mapMy.emplace_hint(hint, i * 2 + 1, -i), -i);
+    EXPECT_EQ(*mapMy.try_emplace(hint, i * 2, 7), i);
+    mapBase.emplace(i * 2 + 1, -i);
+  }
+  for (int i = 0; i < 1000; i += 7) mapMy.insert(mapMy.begin(), {i * 5, 1});
+  for (int i = 0; i < 1000; i += 7) mapBase.insert({i * 5, 1});
+
+  EXPECT_EQ(mapMy.size(), mapBase.size());
+  auto iterBase = mapBase.begin();
+  for (auto iterMy = mapMy.begin(); iterMy != mapMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, (iterBase++)->second);
+}
+
+TEST(map, eraseRangeAndKey) {
+  s21::map<int, int> mapMy;
+  std::map<int, int> mapBase;
+  for (int i = 0; i < 3000; ++i) {
+    mapMy.insert(i, -i);
+    mapBase.insert({i, -i});
+  }
+  auto next = mapMy.erase(mapMy.find(100), mapMy.find(110));
+  mapBase.erase(mapBase.find(100), mapBase.find(110));
+  EXPECT_EQ(*next, -110);
+  next = mapMy.erase(mapMy.lower_bound(500), mapMy.lower_bound(2500));
+  mapBase.erase(mapBase.lower_bound(500), mapBase.lower_bound(2500));
+  EXPECT_EQ(*next, -2500);
+  EXPECT_TRUE(mapMy.erase(mapMy.begin(), mapMy.begin()) == mapMy.begin());
+  EXPECT_EQ(mapMy.erase(7), 1u);
+  EXPECT_EQ(mapMy.erase(7), 0u);
+  mapBase.erase(7);
+
+  EXPECT_EQ(mapMy.size(), mapBase.size());
+  auto iterBase = mapBase.begin();
+  for (auto iterMy = mapMy.begin(); iterMy != mapMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, (iterBase++)->second);
+  EXPECT_EQ(*mapMy.nth(600), -2611);
+  mapMy.erase(mapMy.begin(), mapMy.end());
+  EXPECT_TRUE(mapMy.empty());
+}
+
+TEST(map, eraseIf) {
+  s21::map<int, std::string> mapMy;
+  for (int i = 0; i < 1000; ++i) mapMy.insert(i, std::to_string(i % 10));
+
+  size_t erased = mapMy.erase_if([](const int& key, std::string& value) {
+    return key < 300 || value == "5";
+  });
+  EXPECT_EQ(erased, 370u);
+  EXPECT_EQ(mapMy.erase_if([](const int& key, std::string&) {
+    return key == 999;
+  }),
+            1u);
+
+  EXPECT_EQ(mapMy.size(), 629u);
+  EXPECT_TRUE(mapMy.begin() == mapMy.find(300));
+  EXPECT_FALSE(mapMy.contains(305));
+  EXPECT_EQ(mapMy.rank(998), 628u);
+}
+
+TEST(map, findBatch) {
+  s21::map<std::string, int> mapMy{{"a", 1}, {"b", 2}, {"d", 4}};
+  std::string keys[] = {"d", "c", "a", "a", "e"};
+  s21::map<std::string, int>::iterator found[5];
+  bool present[5];
+
+  mapMy.find_batch(std::begin(keys), std::end(keys), found);
+  mapMy.contains_batch(std::begin(keys), std::end(keys), present);
+
+  EXPECT_EQ(*found[0], 4);
+  EXPECT_TRUE(found[1] == mapMy.end());
+  EXPECT_EQ(*found[3], 1);
+  EXPECT_TRUE(found[4] == mapMy.end());
+  EXPECT_TRUE(present[0] && present[2] && present[3]);
+  EXPECT_FALSE(present[1] || present[4]);
+  s21::map<std::string, int> mapEmpty;
+  EXPECT_EQ(mapEmpty.contains_batch(keys, keys + 5, present), present + 5);
+  EXPECT_FALSE(present[0]);
+}
+
+TEST(map, saveAndLoad) {
+  std::string path = ::testing::TempDir() + "s21_map_save.snap";
+  s21::map<int, double> mapMy;
+  for (int i = 0; i < 3000; ++i) mapMy.insert({i * 11 % 3001, i * 0.5});
+  s21::save_snapshot(mapMy, path);
+
+  s21::map<int, double> loaded;
+  s21::load_snapshot(loaded, path);
+  EXPECT_EQ(loaded.size(), mapMy.size());
+  auto iterMy = mapMy.begin();
+  for (auto iterLoaded = loaded.begin(); iterLoaded != loaded.end();
+       ++iterLoaded)
+    EXPECT_EQ(*iterLoaded, *iterMy++);
+  EXPECT_EQ(loaded.at(11), 0.5);
+  loaded[5000] = 1.5;
+  EXPECT_EQ(loaded.size(), mapMy.size() + 1);
+
+  s21::map<int, float> narrower;
+  EXPECT_THROW(s21::load_snapshot(narrower, path), std::runtime_error);
+  std::remove(path.c_str());
+}
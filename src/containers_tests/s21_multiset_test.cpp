@@ -1,3 +1,7 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
 #include "../s21_containers_test.h"
 
 TEST(multiset, defaultConstructor) {
@@ -277,4 +281,232 @@ TEST(multitest, insertMany) {
   auto s21IterEnd = s21Multiset.end();
   for (; s21Iter != s21IterEnd; ++s21Iter, ++stlIter)
     EXPECT_EQ(*s21Iter, *stlIter);
-}
\ No newline at end of file
+}
+
+TEST(multiset, nth) {
+  s21::multiset<int> s21Multiset{0, 1, 2, 3, 3, 1, 6, 7, 6};
+  std::multiset<int> stlMultiset{0, 1, 2, 3, 3, 1, 6, 7, 6};
+
+  auto stlIter = stlMultiset.begin();
+  for (size_t k = 0; k < stlMultiset.size(); ++k, ++stlIter)
+    EXPECT_EQ(*s21Multiset.nth(k), *stlIter);
+  EXPECT_TRUE(s21Multiset.nth(9) == s21Multiset.end());
+}
+
+TEST(multiset, rank) {
+  s21::multiset<int> s21Multiset{0, 1, 2, 3, 3, 1, 6, 7, 6};
+
+  EXPECT_EQ(s21Multiset.rank(0), 0);
+  EXPECT_EQ(s21Multiset.rank(1), 1);
+  EXPECT_EQ(s21Multiset.rank(3), 4);
+  EXPECT_EQ(s21Multiset.rank(6), 6);
+  EXPECT_EQ(s21Multiset.rank(8), 9);
+}
+
+TEST(multiset, polymorphicAllocator) {
+  CountingResource resource;
+  {
+    using Alloc = std::pmr::polymorphic_allocator<int>;
+    s21::multiset<int, Alloc> multiset({2, 1, 2}, Alloc(&resource));
+    multiset.insert(2);
+
+    EXPECT_EQ(multiset.size(), 4u);
+    EXPECT_EQ(multiset.count(2), 3u);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
+
+TEST(multiset, boundsMatchStl) {
+  s21::multiset<int> s21Multiset;
+  std::multiset<int> stlMultiset;
+  for (int i = 0; i < 500; ++i) {
+    s21Multiset.insert(i * 7 % 61);
+    stlMultiset.insert(i * 7 % 61);
+  }
+
+  for (int key = -1; key <= 62; ++key) {
+    auto s21Range = s21Multiset.equal_range(key);
+    auto stlRange = stlMultiset.equal_range(key);
+
+    EXPECT_EQ(s21Multiset.count(key), stlMultiset.count(key));
+    EXPECT_EQ(s21Range.first == s21Multiset.end(),
+              stlRange.first == stlMultiset.end());
+    EXPECT_EQ(s21Range.second == s21Multiset.end(),
+              stlRange.second == stlMultiset.end());
+    if (stlRange.first != stlMultiset.end()) {
+      EXPECT_EQ(*s21Range.first, *stlRange.first);
+    }
+    if (stlRange.second != stlMultiset.end()) {
+      EXPECT_EQ(*s21Range.second, *stlRange.second);
+    }
+  }
+}
+
+TEST(multiset, assignSorted) {
+  std::vector<int> keys{1, 1, 2, 3, 3, 3, 4};
+  s21::multiset<int> s21Multiset{9, 9};
+  s21Multiset.assign_sorted(keys.begin(), keys.end());
+
+  EXPECT_EQ(s21Multiset.size(), keys.size());
+  EXPECT_EQ(s21Multiset.count(3), 3u);
+  EXPECT_EQ(s21Multiset.count(9), 0u);
+  auto key = keys.begin();
+  for (auto it = s21Multiset.begin(); it != s21Multiset.end(); ++it)
+    EXPECT_EQ(*it, *key++);
+}
+
+TEST(multiset, mergeRelinksNodes) {
+  CountingResource resource;
+  using Alloc = std::pmr::polymorphic_allocator<int>;
+  s21::multiset<int, Alloc> s21Multiset({1, 2, 2}, Alloc(&resource));
+  s21::multiset<int, Alloc> s21MergeMultiset({2, 3}, Alloc(&resource));
+  size_t allocations = resource.allocations;
+
+  s21Multiset.merge(s21MergeMultiset);
+
+  EXPECT_EQ(resource.allocations, allocations);
+  EXPECT_EQ(s21Multiset.size(), 5u);
+  EXPECT_EQ(s21Multiset.count(2), 3u);
+  EXPECT_TRUE(s21MergeMultiset.empty());
+}
+
+TEST(multiset, extractAndInsertNode) {
+  s21::multiset<int> s21Multiset{1, 2, 2};
+  s21::multiset<int> s21Other{2};
+
+  auto nh = s21Multiset.extract(2);
+  EXPECT_EQ(nh.value(), 2);
+  EXPECT_EQ(s21Multiset.count(2), 1u);
+
+  auto it = s21Other.insert(std::move(nh));
+  EXPECT_EQ(*it, 2);
+  EXPECT_TRUE(nh.empty());
+  EXPECT_EQ(s21Other.count(2), 2u);
+  EXPECT_TRUE(s21Other.insert(std::move(nh)) == s21Other.end());
+}
+
+TEST(multiset, splitKeepsEqualKeysTogether) {
+  s21::multiset<int> s21Multiset{1, 2, 2, 2, 3, 2, 4};
+  s21::multiset<int> s21Greater;
+
+  s21Multiset.split(2, s21Greater);
+
+  EXPECT_EQ(s21Multiset.size(), 1u);
+  EXPECT_EQ(s21Greater.size(), 6u);
+  EXPECT_EQ(s21Greater.count(2), 4u);
+
+  s21Multiset.join(s21Greater);
+  EXPECT_EQ(s21Multiset.size(), 7u);
+  EXPECT_EQ(s21Multiset.count(2), 4u);
+}
+
+TEST(multiset, emplaceAndMoveInsert) {
+  s21::multiset<std::string> s21Multiset;
+
+  s21Multiset.emplace(2, 'x');
+  s21Multiset.emplace("xx");
+  std::string value = "a";
+  s21Multiset.insert(std::move(value));
+  auto iter = s21Multiset.emplace_hint(s21Multiset.end(), "z");
+
+  EXPECT_EQ(*iter, "z");
+  EXPECT_EQ(s21Multiset.size(), 4u);
+  EXPECT_EQ(s21Multiset.count("xx"), 2u);
+  EXPECT_EQ(*s21Multiset.begin(), "a");
+}
+
+TEST(multiset, compactNodeSize) {
+  if (sizeof(void*) == 8) {
+    EXPECT_LE(sizeof(s21::multiset<int>::Node), 32u);
+    EXPECT_LE(sizeof(s21::multiset<long>::Node), 40u);
+  }
+}
+
+TEST(multiset, hintedInsert) {
+  s21::multiset<std::pair<int, int>> s21Multiset;
+  for (int i = 0; i < 1000; ++i)
+    s21Multiset.insert(s21Multiset.end(), std::make_pair(i / 10, 0));
+  auto hint = s21Multiset.find(std::make_pair(50, 0));
+  auto iter = s21Multiset.emplace_hint(hint, 50, 0);
+
+  EXPECT_TRUE(++iter == hint);
+  EXPECT_EQ(s21Multiset.count(std::make_pair(50, 0)), 11u);
+  s21Multiset.insert(s21Multiset.begin(), std::make_pair(200, 0));
+  s21Multiset.insert(s21Multiset.end(), std::make_pair(-1, 0));
+  EXPECT_EQ((*s21Multiset.begin()).first, -1);
+  EXPECT_EQ((*--s21Multiset.end()).first, 200);
+
+  std::pair<int, int> last(-2, 0);
+  for (auto element : s21Multiset) {
+    EXPECT_FALSE(element < last);
+    last = element;
+  }
+  EXPECT_EQ(s21Multiset.size(), 1003u);
+}
+
+TEST(multiset, insertPastMaxSize) {
+  struct Full : s21::multiset<int> {
+    void setFull(bool full) {
+      this->root->size = static_cast<uint32_t>(full ? this->max_size() : 1);
+    }
+  };
+  Full setMy;
+  setMy.insert(1);
+  s21::multiset<int> other{1};
+  setMy.setFull(true);
+
+  EXPECT_THROW(setMy.insert(1), std::length_error);
+  EXPECT_THROW(setMy.insert(setMy.begin(), 1), std::length_error);
+  EXPECT_THROW(setMy.merge(other), std::length_error);
+  EXPECT_EQ(other.size(), 1u);
+  setMy.setFull(false);
+  EXPECT_EQ(setMy.size(), 1u);
+}
+
+TEST(multiset, eraseRangeAndKey) {
+  s21::multiset<int> s21Multiset;
+  std::multiset<int> stlMultiset;
+  for (int i = 0; i < 2000; ++i) {
+    s21Multiset.insert(i % 50);
+    stlMultiset.insert(i % 50);
+  }
+
+  EXPECT_EQ(s21Multiset.erase(10), 40u);
+  EXPECT_EQ(s21Multiset.erase(10), 0u);
+  stlMultiset.erase(10);
+  auto first = s21Multiset.find(20), last = s21Multiset.find(30);
+  ++++first;
+  ++last;
+  auto stlFirst = stlMultiset.find(20), stlLast = stlMultiset.find(30);
+  ++++stlFirst;
+  ++stlLast;
+  s21Multiset.erase(first, last);
+  stlMultiset.erase(stlFirst, stlLast);
+
+  EXPECT_EQ(s21Multiset.size(), stlMultiset.size());
+  EXPECT_EQ(s21Multiset.count(20), 2u);
+  EXPECT_EQ(s21Multiset.count(30), 39u);
+  auto stlIter = stlMultiset.begin();
+  for (auto iter = s21Multiset.begin(); iter != s21Multiset.end(); ++iter)
+    EXPECT_EQ(*iter, *stlIter++);
+}
+
+TEST(multiset, saveAndLoad) {
+  std::string path = ::testing::TempDir() + "s21_multiset_save.snap";
+  s21::multiset<int> msMy;
+  for (int i = 0; i < 4000; ++i) msMy.insert(i % 97);
+  s21::save_snapshot(msMy, path);
+
+  s21::multiset<int> loaded{5};
+  s21::load_snapshot(loaded, path);
+  EXPECT_EQ(loaded.size(), msMy.size());
+  EXPECT_EQ(loaded.count(3), msMy.count(3));
+  auto iterMy = msMy.begin();
+  for (auto iterLoaded = loaded.begin(); iterLoaded != loaded.end();
+       ++iterLoaded)
+    EXPECT_EQ(*iterLoaded, *iterMy++);
+  loaded.insert(3);
+  EXPECT_EQ(loaded.count(3), msMy.count(3) + 1);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,214 @@
+#include <functional>
+#include <set>
+#include <utility>
+
+#include "../s21_containers_test.h"
+
+TEST(nodePool, reusesFreedBlocks) {
+  s21::NodePool pool;
+  void *first = pool.allocate(40);
+  void *second = pool.allocate(40);
+
+  EXPECT_NE(first, second);
+  pool.deallocate(first, 40);
+  EXPECT_EQ(pool.allocate(40), first);
+  EXPECT_EQ(pool.slab_count(), 1);
+}
+
+TEST(nodePool, sizeClassesDoNotMix) {
+  s21::NodePool pool;
+  void *small = pool.allocate(16);
+  pool.deallocate(small, 16);
+
+  EXPECT_NE(pool.allocate(48), small);
+  EXPECT_EQ(pool.allocate(16), small);
+  EXPECT_EQ(pool.slab_count(), 2);
+}
+
+TEST(nodePool, largeBlocksBypassSlabs) {
+  s21::NodePool pool;
+  void *block = pool.allocate(s21::NodePool::kMaxBlockSize + 1);
+
+  EXPECT_NE(block, nullptr);
+  EXPECT_EQ(pool.slab_count(), 0);
+  pool.deallocate(block, s21::NodePool::kMaxBlockSize + 1);
+}
+
+TEST(nodePool, release) {
+  s21::NodePool pool;
+  for (int i = 0; i < 1000; ++i) pool.allocate(32);
+
+  EXPECT_GT(pool.slab_count(), 1);
+  EXPECT_GE(pool.bytes_reserved(), 1000 * 32);
+  pool.release();
+  EXPECT_EQ(pool.slab_count(), 0);
+  EXPECT_EQ(pool.bytes_reserved(), 0);
+  EXPECT_NE(pool.allocate(32), nullptr);
+}
+
+TEST(nodePool, clearReleasesOwnPool) {
+  s21::set<int> setMy;
+  for (int i = 0; i < 100; ++i) setMy.insert(i);
+  auto pool = setMy.get_allocator().pool();
+
+  EXPECT_GT(pool->slab_count(), 0);
+  pool.reset();
+  setMy.clear();
+  EXPECT_EQ(setMy.get_allocator().pool()->slab_count(), 0);
+  EXPECT_TRUE(setMy.empty());
+}
+
+TEST(nodePool, sharedBetweenContainers) {
+  auto pool = std::make_shared<s21::NodePool>();
+  s21::set<int> first(pool);
+  s21::map<int, int> second(pool);
+  std::set<int> base;
+  for (int i = 0; i < 100; ++i) {
+    first.insert(i * 3 % 101);
+    second.insert(i, i);
+    base.insert(i * 3 % 101);
+  }
+  auto slabs = pool->slab_count();
+  first.clear();
+  for (int i = 0; i < 100; ++i) first.insert(i * 3 % 101);
+
+  EXPECT_EQ(pool->slab_count(), slabs);
+  EXPECT_EQ(first.get_allocator().pool(), pool);
+  EXPECT_EQ(second.size(), 100);
+  auto iterBase = base.begin();
+  for (auto iterMy = first.begin(); iterMy != first.end(); ++iterMy, ++iterBase)
+    EXPECT_EQ(*iterMy, *iterBase);
+}
+
+TEST(nodePool, moveKeepsNodesWithPool) {
+  s21::multiset<int> source{3, 1, 2, 2};
+  auto pool = source.get_allocator().pool();
+  s21::multiset<int> moved(std::move(source));
+
+  EXPECT_EQ(moved.get_allocator().pool(), pool);
+  EXPECT_EQ(moved.size(), 4);
+  EXPECT_EQ(*moved.begin(), 1);
+}
+
+TEST(nodePool, mergeWithinSharedPool) {
+  auto pool = std::make_shared<s21::NodePool>();
+  s21::set<int> setMy(pool), setOther(pool);
+  for (int i = 0; i < 100; ++i) (i % 2 ? setMy : setOther).insert(i);
+  auto slabs = pool->slab_count();
+
+  setMy.merge(setOther);
+
+  EXPECT_EQ(pool->slab_count(), slabs);
+  EXPECT_EQ(setMy.size(), 100u);
+  EXPECT_TRUE(setOther.empty());
+}
+
+TEST(nodePool, mergeKeepsSourceAllocator) {
+  s21::set<int> setMy{1}, setOther{2, 3};
+  auto pool = setOther.get_allocator().pool();
+  auto slabs = pool->slab_count();
+  int *two = &*setOther.find(2);
+
+  setMy.merge(setOther);
+
+  EXPECT_EQ(setOther.get_allocator().pool(), pool);
+  EXPECT_NE(setMy.get_allocator().pool(), pool);
+  EXPECT_EQ(pool->slab_count(), slabs);
+  EXPECT_NE(&*setMy.find(2), two);
+  EXPECT_EQ(setMy.size(), 3u);
+  EXPECT_TRUE(setOther.empty());
+}
+
+TEST(nodePool, nodeHandleOutlivesContainer) {
+  s21::set<int>::node_type nh;
+  {
+    s21::set<int> setMy{1, 2, 3};
+    nh = setMy.extract(2);
+  }
+  s21::set<int> setOther{1};
+  auto result = setOther.insert(std::move(nh));
+
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(*result.position, 2);
+  EXPECT_EQ(setOther.size(), 2u);
+}
+
+TEST(nodePool, defaultAllocatorCopiesSharePool) {
+  s21::PoolAllocator<int> alloc;
+  s21::PoolAllocator<double> rebound(alloc);
+  s21::PoolAllocator<int> copy(alloc);
+  s21::PoolAllocator<int> moved(std::move(copy));
+
+  EXPECT_NE(alloc.pool(), nullptr);
+  EXPECT_TRUE(rebound == alloc);
+  EXPECT_TRUE(moved == alloc);
+  EXPECT_TRUE(copy == alloc);
+}
+
+TEST(nodePool, poolCreatedOnFirstUse) {
+  s21::PoolAllocator<int> alloc, other;
+  s21::PoolAllocator<int> moved(std::move(other));
+
+  EXPECT_TRUE(alloc == other);
+  EXPECT_TRUE(moved == other);
+  int *block = alloc.allocate(1);
+  EXPECT_FALSE(alloc == other);
+  s21::PoolAllocator<double> rebound(other);
+  EXPECT_TRUE(rebound == other);
+  EXPECT_FALSE(rebound == moved);
+  alloc.deallocate(block, 1);
+}
+
+TEST(nodePool, emptySetHasNoPool) {
+  struct Probe : s21::set<int> {
+    bool hasPool() {
+      return !(this->allocator == decltype(this->allocator)());
+    }
+  };
+  Probe setMy;
+  Probe setMoved(std::move(setMy));
+
+  EXPECT_FALSE(setMy.hasPool());
+  EXPECT_FALSE(setMoved.hasPool());
+  setMoved.insert(1);
+  EXPECT_TRUE(setMoved.hasPool());
+  EXPECT_TRUE(setMoved.contains(1));
+}
+
+TEST(nodePool, vectorAndList) {
+  s21::vector<int, s21::PoolAllocator<int>> first, second;
+  for (int i = 0; i < 100; ++i) second.push_back(i);
+  first = std::move(second);
+  second.push_back(-1);
+  EXPECT_EQ(first.size(), 100u);
+  EXPECT_EQ(first[99], 99);
+  EXPECT_EQ(second.size(), 1u);
+
+  s21::list<int, s21::PoolAllocator<int>> listFirst, listSecond{1, 2, 3};
+  listFirst = std::move(listSecond);
+  listFirst.push_back(4);
+  listFirst.pop_front();
+  EXPECT_EQ(listFirst.size(), 3u);
+  EXPECT_EQ(listFirst.front(), 2);
+  EXPECT_EQ(listFirst.back(), 4);
+}
+
+TEST(nodePool, reboundContainers) {
+  s21::unordered_set<int, std::hash<int>, std::equal_to<int>,
+                     s21::PoolAllocator<int>>
+      hashSet;
+  s21::btree_set<int, s21::PoolAllocator<int>> btreeSet;
+  for (int i = 0; i < 1000; ++i) {
+    hashSet.insert(i * 7);
+    btreeSet.insert(i * 7);
+  }
+
+  EXPECT_EQ(hashSet.size(), 1000u);
+  EXPECT_EQ(btreeSet.size(), 1000u);
+  EXPECT_TRUE(hashSet.contains(700));
+  EXPECT_TRUE(btreeSet.contains(700));
+  hashSet.clear();
+  btreeSet.clear();
+  EXPECT_TRUE(hashSet.empty());
+  EXPECT_TRUE(btreeSet.empty());
+}
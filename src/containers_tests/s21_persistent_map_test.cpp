@@ -0,0 +1,109 @@
+#include <map>
+#include <string>
+#include <thread>
+
+#include "../s21_containers_test.h"
+
+TEST(persistentMap, insertAndAssign) {
+  s21::persistent_map<int, std::string> mapMy{{2, "b"}, {1, "a"}};
+
+  EXPECT_EQ(mapMy.size(), 2u);
+  EXPECT_FALSE(mapMy.insert(1, "x").second);
+  EXPECT_EQ(mapMy.at(1), "a");
+  EXPECT_FALSE(mapMy.insert_or_assign(1, "x").second);
+  EXPECT_TRUE(mapMy.insert_or_assign(3, "c").second);
+  EXPECT_EQ(mapMy.at(1), "x");
+  EXPECT_THROW(mapMy.at(4), std::out_of_range);
+
+  std::string keys, values;
+  for (auto iter = mapMy.begin(); iter != mapMy.end(); ++iter) {
+    keys += std::to_string(iter.key());
+    values += *iter;
+  }
+  EXPECT_EQ(keys, "123");
+  EXPECT_EQ(values, "xbc");
+}
+
+TEST(persistentMap, snapshotIsUnaffected) {
+  s21::persistent_map<int, int> mapMy;
+  for (int i = 0; i < 1000; ++i) mapMy.insert(i, i);
+  auto snapshot = mapMy.snapshot();
+
+  for (int i = 0; i < 1000; i += 2) mapMy.erase(i);
+  for (int i = 1; i < 1000; i += 2) mapMy.insert_or_assign(i, -i);
+  mapMy.insert(5000, 0);
+
+  EXPECT_EQ(snapshot.size(), 1000u);
+  EXPECT_EQ(mapMy.size(), 501u);
+  int expected = 0;
+  for (auto iter = snapshot.begin(); iter != snapshot.end(); ++iter) {
+    EXPECT_EQ(iter.key(), expected);
+    EXPECT_EQ(*iter, expected++);
+  }
+  EXPECT_EQ(mapMy.at(7), -7);
+  EXPECT_FALSE(mapMy.contains(8));
+}
+
+TEST(persistentMap, matchesStdMap) {
+  s21::persistent_map<int, int> mapMy;
+  std::map<int, int> mapBase;
+  unsigned seed = 7;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 700;
+    if (i % 3 == 2) {
+      EXPECT_EQ(mapMy.erase(key), mapBase.erase(key));
+    } else {
+      mapMy.insert_or_assign(key, i);
+      mapBase[key] = i;
+    }
+  }
+
+  EXPECT_EQ(mapMy.size(), mapBase.size());
+  auto iterMy = mapMy.begin();
+  for (const auto &item : mapBase) {
+    EXPECT_EQ(iterMy.key(), item.first);
+    EXPECT_EQ(*iterMy++, item.second);
+  }
+  EXPECT_TRUE(iterMy == mapMy.end());
+  EXPECT_EQ(mapMy.lower_bound(350).key(), mapBase.lower_bound(350)->first);
+  EXPECT_EQ(mapMy.upper_bound(350).key(), mapBase.upper_bound(350)->first);
+}
+
+TEST(persistentMap, readSnapshotWhileWriting) {
+  s21::persistent_map<int, int> mapMy;
+  for (int i = 0; i < 2000; ++i) mapMy.insert(i, i);
+
+  auto snapshot = mapMy.snapshot();
+  long long sum = 0;
+  std::thread reader([&snapshot, &sum]() {
+    for (int round = 0; round < 20; ++round)
+      for (auto iter = snapshot.begin(); iter != snapshot.end(); ++iter)
+        sum += *iter;
+  });
+  for (int i = 0; i < 2000; ++i) {
+    mapMy.erase(i);
+    mapMy.insert(i + 2000, 0);
+  }
+  reader.join();
+
+  EXPECT_EQ(sum, 20ll * 1999 * 2000 / 2);
+  EXPECT_EQ(mapMy.begin().key(), 2000);
+}
+
+TEST(persistentSet, snapshotAndErase) {
+  s21::persistent_set<int> setMy{5, 1, 3, 1};
+  auto snapshot = setMy.snapshot();
+
+  EXPECT_EQ(setMy.size(), 3u);
+  EXPECT_EQ(setMy.erase(1), 1u);
+  EXPECT_EQ(setMy.erase(1), 0u);
+  EXPECT_TRUE(setMy.insert(4).second);
+  EXPECT_EQ(*setMy.begin(), 3);
+  EXPECT_EQ(*snapshot.begin(), 1);
+  EXPECT_TRUE(snapshot.find(4) == snapshot.end());
+
+  setMy.clear();
+  EXPECT_TRUE(setMy.empty());
+  EXPECT_EQ(snapshot.size(), 3u);
+}
@@ -136,4 +136,17 @@ TEST(queue, insertManyBack) {
     s21_queue.pop();
     std_queue.pop();
   }
-}
\ No newline at end of file
+}
+TEST(queue, polymorphicAllocator) {
+  CountingResource resource;
+  {
+    using Alloc = std::pmr::polymorphic_allocator<int>;
+    s21::queue<int, s21::list<int, Alloc>> queue({1, 2}, Alloc(&resource));
+    queue.push(3);
+
+    EXPECT_EQ(queue.front(), 1);
+    EXPECT_EQ(queue.back(), 3);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
@@ -1,4 +1,11 @@
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
 
 #include "../s21_containers_test.h"
 
@@ -203,7 +210,8 @@ TEST(set, find) {
   auto iterBase2 = setBase.find(2.);
 
   EXPECT_EQ(*iterMy1, *iterBase1);
-  EXPECT_EQ(*iterMy2, *iterBase2);
+  EXPECT_TRUE(iterMy2 == setMy.end());
+  EXPECT_TRUE(iterBase2 == setBase.end());
 }
 
 TEST(set, contains) {
@@ -227,4 +235,436 @@ TEST(set, insertMany) {
   auto iterMyEnd = setMy.end();
   for (; iterMy != iterMyEnd; ++iterMy, ++iterBase)
     EXPECT_EQ(*iterMy, *iterBase);
-}
\ No newline at end of file
+}
+
+TEST(set, nth) {
+  s21::set<int> setMy = {50, 20, 80, 10, 30, 70, 90, 60, 40};
+  std::set<int> setBase = {50, 20, 80, 10, 30, 70, 90, 60, 40};
+
+  auto iterBase = setBase.begin();
+  for (size_t k = 0; k < setBase.size(); ++k, ++iterBase)
+    EXPECT_EQ(*setMy.nth(k), *iterBase);
+  EXPECT_TRUE(setMy.nth(setBase.size()) == setMy.end());
+}
+
+TEST(set, rank) {
+  s21::set<int> setMy = {50, 20, 80, 10, 30, 70, 90, 60, 40};
+
+  EXPECT_EQ(setMy.rank(5), 0);
+  EXPECT_EQ(setMy.rank(10), 0);
+  EXPECT_EQ(setMy.rank(11), 1);
+  EXPECT_EQ(setMy.rank(50), 4);
+  EXPECT_EQ(setMy.rank(90), 8);
+  EXPECT_EQ(setMy.rank(100), 9);
+}
+
+TEST(set, orderStatisticsAfterErase) {
+  s21::set<int> setMy;
+  std::set<int> setBase;
+  for (int i = 0; i < 1000; ++i) {
+    int value = (i * 7919) % 1009;
+    setMy.insert(value);
+    setBase.insert(value);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    int value = (i * 7919) % 1009;
+    setMy.erase(setMy.find(value));
+    setBase.erase(value);
+  }
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  size_t k = 0;
+  for (int value : setBase) {
+    EXPECT_EQ(*setMy.nth(k), value);
+    EXPECT_EQ(setMy.rank(value), k);
+    ++k;
+  }
+}
+
+TEST(set, iterateBothDirections) {
+  s21::set<int> setMy;
+  std::set<int> setBase;
+  for (int i = 0; i < 200; ++i) {
+    setMy.insert((i * 37) % 211);
+    setBase.insert((i * 37) % 211);
+  }
+  setMy.erase(--setMy.end());
+  setBase.erase(--setBase.end());
+  setMy.erase(setMy.begin());
+  setBase.erase(setBase.begin());
+
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy, ++iterBase)
+    EXPECT_EQ(*iterMy, *iterBase);
+  EXPECT_TRUE(iterBase == setBase.end());
+
+  auto riterBase = setBase.rbegin();
+  auto iterMy = setMy.end();
+  while (iterMy != setMy.begin()) EXPECT_EQ(*--iterMy, *riterBase++);
+  EXPECT_TRUE(riterBase == setBase.rend());
+}
+
+TEST(set, emptyBeginIsEnd) {
+  s21::set<int> setMy;
+  EXPECT_TRUE(setMy.begin() == setMy.end());
+  EXPECT_TRUE(setMy.find(1) == setMy.end());
+  setMy.insert(1);
+  setMy.erase(setMy.begin());
+  EXPECT_TRUE(setMy.begin() == setMy.end());
+  EXPECT_TRUE(setMy.find(1) == setMy.end());
+}
+
+TEST(set, polymorphicAllocator) {
+  CountingResource resource;
+  {
+    using Alloc = std::pmr::polymorphic_allocator<int>;
+    s21::set<int, Alloc> set({3, 1, 2}, Alloc(&resource));
+    set.insert(4);
+    set.erase(set.find(1));
+    s21::set<int, Alloc> moved(std::move(set));
+
+    EXPECT_EQ(moved.size(), 3u);
+    EXPECT_EQ(*moved.begin(), 2);
+    EXPECT_TRUE(moved.get_allocator() == Alloc(&resource));
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
+
+TEST(set, bounds) {
+  s21::set<int> setMy{10, 20, 30, 40};
+
+  EXPECT_EQ(*setMy.lower_bound(20), 20);
+  EXPECT_EQ(*setMy.upper_bound(20), 30);
+  EXPECT_EQ(*setMy.lower_bound(25), 30);
+  EXPECT_EQ(*setMy.lower_bound(0), 10);
+  EXPECT_TRUE(setMy.lower_bound(41) == setMy.end());
+  EXPECT_TRUE(setMy.upper_bound(40) == setMy.end());
+
+  auto range = setMy.equal_range(30);
+  EXPECT_EQ(*range.first, 30);
+  EXPECT_EQ(*range.second, 40);
+  range = setMy.equal_range(35);
+  EXPECT_TRUE(range.first == range.second);
+}
+
+TEST(set, rangeConstructorUnsorted) {
+  std::vector<int> keys{5, 3, 9, 3, 1, 5, 7};
+  s21::set<int> setMy(keys.begin(), keys.end());
+  std::set<int> setBase(keys.begin(), keys.end());
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+}
+
+TEST(set, assignSorted) {
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i * 2);
+  s21::set<int> setMy{42};
+  setMy.assign_sorted(keys.begin(), keys.end());
+
+  EXPECT_EQ(setMy.size(), 1000u);
+  EXPECT_EQ(*setMy.begin(), 0);
+  EXPECT_EQ(*setMy.nth(500), 1000);
+  EXPECT_EQ(*--setMy.end(), 1998);
+  EXPECT_FALSE(setMy.contains(41));
+  setMy.insert(41);
+  setMy.erase(setMy.find(0));
+  EXPECT_EQ(*setMy.nth(20), 41);
+}
+
+TEST(set, mergeLeavesDuplicates) {
+  s21::set<int> setMy{1, 3, 5};
+  s21::set<int> setMyForMerge{2, 3, 4, 5};
+  setMy.merge(setMyForMerge);
+
+  EXPECT_EQ(setMy.size(), 5u);
+  EXPECT_EQ(setMyForMerge.size(), 2u);
+  EXPECT_EQ(*setMyForMerge.begin(), 3);
+  EXPECT_EQ(*setMy.nth(1), 2);
+  EXPECT_EQ(*setMy.nth(3), 4);
+}
+
+TEST(set, mergeRelinksNodes) {
+  CountingResource resource;
+  using Alloc = std::pmr::polymorphic_allocator<int>;
+  s21::set<int, Alloc> setMy({1, 2}, Alloc(&resource));
+  s21::set<int, Alloc> setMyForMerge({2, 3, 4}, Alloc(&resource));
+  int *three = &*setMyForMerge.find(3);
+  size_t allocations = resource.allocations;
+
+  setMy.merge(setMyForMerge);
+
+  EXPECT_EQ(resource.allocations, allocations);
+  EXPECT_EQ(&*setMy.find(3), three);
+  EXPECT_EQ(setMy.size(), 4u);
+  EXPECT_EQ(setMyForMerge.size(), 1u);
+}
+
+TEST(set, extractAndInsertNode) {
+  s21::set<int> setMy{1, 2, 3};
+  s21::set<int> setOther{3};
+  int *two = &*setMy.find(2);
+
+  auto nh = setMy.extract(2);
+  EXPECT_FALSE(nh.empty());
+  EXPECT_EQ(nh.value(), 2);
+  EXPECT_EQ(setMy.size(), 2u);
+  EXPECT_FALSE(setMy.contains(2));
+  EXPECT_TRUE(setMy.extract(42).empty());
+
+  nh.value() = 5;
+  auto result = setMy.insert(std::move(nh));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&*result.position, two);
+  EXPECT_EQ(*--setMy.end(), 5);
+
+  result = setMy.insert(setOther.extract(setOther.begin()));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.value(), 3);
+  EXPECT_EQ(*result.position, 3);
+  EXPECT_TRUE(setOther.empty());
+}
+
+TEST(set, setAlgebra) {
+  s21::set<int> setA{1, 2, 3, 4, 5, 6};
+  s21::set<int> setB{4, 5, 6, 7, 8};
+  std::set<int> expected;
+
+  s21::set<int> united(setA);
+  united.set_union(setB);
+  expected = {1, 2, 3, 4, 5, 6, 7, 8};
+  EXPECT_EQ(united.size(), expected.size());
+  auto iter = united.begin();
+  for (int key : expected) EXPECT_EQ(*iter++, key);
+
+  s21::set<int> common(setA);
+  common.set_intersection(setB);
+  expected = {4, 5, 6};
+  EXPECT_EQ(common.size(), expected.size());
+  iter = common.begin();
+  for (int key : expected) EXPECT_EQ(*iter++, key);
+
+  setA.set_difference(setB);
+  expected = {1, 2, 3};
+  EXPECT_EQ(setA.size(), expected.size());
+  iter = setA.begin();
+  for (int key : expected) EXPECT_EQ(*iter++, key);
+  EXPECT_EQ(setB.size(), 5u);
+}
+
+TEST(set, setAlgebraLarge) {
+  s21::set<int> setA, setB;
+  std::set<int> baseA, baseB;
+  for (int i = 0; i < 2000; ++i) {
+    setA.insert(i * 3 % 2003);
+    baseA.insert(i * 3 % 2003);
+  }
+  for (int i = 0; i < 300; ++i) {
+    setB.insert(i * 7);
+    baseB.insert(i * 7);
+  }
+
+  std::set<int> expected;
+  std::set_intersection(baseA.begin(), baseA.end(), baseB.begin(),
+                        baseB.end(), std::inserter(expected, expected.end()));
+  setA.set_intersection(setB);
+
+  EXPECT_EQ(setA.size(), expected.size());
+  size_t k = 0;
+  for (int key : expected) EXPECT_EQ(*setA.nth(k++), key);
+}
+
+TEST(set, splitAndJoin) {
+  s21::set<int> setMy{1, 2, 3, 4, 5, 6, 7};
+  s21::set<int> greater{42};
+
+  setMy.split(4, greater);
+  EXPECT_EQ(setMy.size(), 3u);
+  EXPECT_EQ(*--setMy.end(), 3);
+  EXPECT_EQ(greater.size(), 4u);
+  EXPECT_EQ(*greater.begin(), 4);
+  EXPECT_EQ(*--greater.end(), 7);
+
+  setMy.join(greater);
+  EXPECT_TRUE(greater.empty());
+  EXPECT_EQ(setMy.size(), 7u);
+  EXPECT_EQ(*setMy.nth(3), 4);
+  EXPECT_EQ(setMy.rank(6), 5u);
+}
+
+TEST(set, copyLargeTree) {
+  s21::set<int> setMy;
+  for (int i = 0; i < 100000; ++i) setMy.insert(i * 7919 % 100003);
+  s21::set<int> setCopy(setMy);
+
+  EXPECT_EQ(setCopy.size(), setMy.size());
+  auto iterMy = setMy.begin();
+  for (auto iter = setCopy.begin(); iter != setCopy.end(); ++iter)
+    EXPECT_EQ(*iter, *iterMy++);
+  EXPECT_EQ(*setCopy.nth(50000), *setMy.nth(50000));
+  setCopy.erase(setCopy.begin());
+  EXPECT_EQ(setCopy.size() + 1, setMy.size());
+}
+
+TEST(set, emplaceAndMoveInsert) {
+  s21::set<std::string> setMy;
+
+  EXPECT_TRUE(setMy.emplace(3, 'a').second);
+  EXPECT_FALSE(setMy.emplace("aaa").second);
+  std::string value = "b";
+  EXPECT_TRUE(setMy.insert(std::move(value)).second);
+  auto iter = setMy.emplace_hint(setMy.begin(), "c");
+
+  EXPECT_EQ(*iter, "c");
+  EXPECT_EQ(setMy.size(), 3u);
+  EXPECT_EQ(*setMy.begin(), "aaa");
+  EXPECT_TRUE(setMy.contains("b"));
+}
+
+TEST(set, compactNodeSize) {
+  if (sizeof(void*) == 8) {
+    EXPECT_LE(sizeof(s21::set<int>::Node), 32u);
+    EXPECT_LE(sizeof(s21::set<double>::Node), 40u);
+    EXPECT_LE(sizeof(s21::set<std::string>::Node), sizeof(std::string) + 32);
+  }
+}
+
+// The limit is 2^32 - 1 elements, so the root's count is inflated instead.
+TEST(set, insertPastMaxSize) {
+  struct Full : s21::set<int> {
+    void setFull(bool full) {
+      this->root->size = static_cast<uint32_t>(full ? this->max_size() : 1);
+    }
+  };
+  Full setMy;
+  setMy.insert(1);
+  s21::set<int> other{2, 3};
+  setMy.setFull(true);
+
+  EXPECT_EQ(setMy.size(), setMy.max_size());
+  EXPECT_THROW(setMy.insert(2), std::length_error);
+  EXPECT_THROW(setMy.insert(setMy.end(), 2), std::length_error);
+  EXPECT_THROW(setMy.insert(other.extract(3)), std::length_error);
+  EXPECT_THROW(setMy.merge(other), std::length_error);
+  EXPECT_FALSE(setMy.insert(1).second);
+  EXPECT_EQ(other.size(), 1u);
+  setMy.setFull(false);
+  EXPECT_EQ(setMy.size(), 1u);
+}
+
+TEST(set, hintedInsert) {
+  s21::set<int> setMy;
+  std::set<int> setBase;
+  for (int i = 0; i < 2000; ++i) {
+    int key = i * 7919 % 2003;
+    auto hint = setMy.lower_bound(key + i % 3 - 1);
+    auto iter = setMy.insert(hint, key);
+    setBase.insert(key);
+    EXPECT_EQ(*iter, key);
+  }
+  EXPECT_EQ(*setMy.insert(setMy.end(), 5), 5);
+  EXPECT_EQ(*setMy.emplace_hint(setMy.begin(), 3000), 3000);
+  setBase.insert(3000);
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+}
+
+TEST(set, eraseIf) {
+  s21::set<int> setMy;
+  std::set<int> setBase;
+  for (int i = 0; i < 5000; ++i) {
+    setMy.insert(i * 7 % 5003);
+    setBase.insert(i * 7 % 5003);
+  }
+
+  size_t erasedBase = 0;
+  for (auto iter = setBase.begin(); iter != setBase.end();)
+    iter = *iter % 3 == 0 ? (++erasedBase, setBase.erase(iter)) : ++iter;
+  EXPECT_EQ(setMy.erase_if([](const int& key) { return key % 3 == 0; }),
+            erasedBase);
+  EXPECT_EQ(setMy.erase_if([](const int& key) { return key == 1; }), 1u);
+  setBase.erase(1);
+  EXPECT_EQ(setMy.erase_if([](const int&) { return false; }), 0u);
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+  setMy.insert(3);
+  EXPECT_EQ(*setMy.begin(), 2);
+  EXPECT_EQ(*++setMy.begin(), 3);
+}
+
+TEST(set, findBatch) {
+  s21::set<int> setMy;
+  for (int i = 0; i < 40000; ++i) setMy.insert(i * 3);
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i * 113 % 120000);
+  std::vector<s21::set<int>::iterator> found(keys.size());
+  std::vector<bool> present;
+
+  auto end = setMy.find_batch(keys.begin(), keys.end(), found.begin());
+  setMy.contains_batch(keys.begin(), keys.end(), std::back_inserter(present));
+
+  EXPECT_TRUE(end == found.end());
+  ASSERT_EQ(present.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_TRUE(found[i] == setMy.find(keys[i]));
+    EXPECT_EQ(present[i], keys[i] % 3 == 0);
+  }
+}
+
+TEST(set, saveAndLoad) {
+  std::string path = ::testing::TempDir() + "s21_set_save.snap";
+  s21::set<int> setMy;
+  for (int i = 0; i < 5000; ++i) setMy.insert(i * 7 % 5003);
+  s21::save_snapshot(setMy, path);
+
+  s21::set<int> loaded{-1, -2};
+  s21::load_snapshot(loaded, path);
+  EXPECT_EQ(loaded.size(), setMy.size());
+  auto iterMy = setMy.begin();
+  for (auto iterLoaded = loaded.begin(); iterLoaded != loaded.end();
+       ++iterLoaded)
+    EXPECT_EQ(*iterLoaded, *iterMy++);
+  EXPECT_EQ(*loaded.nth(100), *setMy.nth(100));
+  EXPECT_EQ(loaded.rank(2500), setMy.rank(2500));
+  loaded.insert(-3);
+  loaded.erase(loaded.find(7));
+  EXPECT_EQ(*loaded.begin(), -3);
+  EXPECT_FALSE(loaded.contains(7));
+
+  s21::set<int> empty;
+  s21::save_snapshot(empty, path);
+  s21::load_snapshot(loaded, path);
+  EXPECT_TRUE(loaded.empty());
+  EXPECT_TRUE(loaded.begin() == loaded.end());
+  std::remove(path.c_str());
+}
+
+TEST(set, loadRejectsForeignFiles) {
+  std::string path = ::testing::TempDir() + "s21_set_reject.snap";
+  s21::set<int> setMy{3, 1, 2};
+
+  std::remove(path.c_str());
+  EXPECT_THROW(s21::load_snapshot(setMy, path), std::system_error);
+  EXPECT_EQ(setMy.size(), 3u);
+
+  s21::set<long long> wider{1, 2};
+  s21::save_snapshot(wider, path);
+  EXPECT_THROW(s21::load_snapshot(setMy, path), std::runtime_error);
+  EXPECT_EQ(setMy.size(), 3u);
+
+  s21::multiset<int> duplicates{1, 2, 2, 3};
+  s21::save_snapshot(duplicates, path);
+  EXPECT_THROW(s21::load_snapshot(setMy, path), std::runtime_error);
+  EXPECT_TRUE(setMy.empty());
+  std::remove(path.c_str());
+}
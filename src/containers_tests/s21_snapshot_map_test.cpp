@@ -0,0 +1,31 @@
+#include <cstdio>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containers_test.h"
+
+TEST(snapshotMap, lookups) {
+  std::string path = ::testing::TempDir() + "s21_snapshot_map.snap";
+  s21::map<long, double> source;
+  std::map<long, double> mapBase;
+  for (long i = 0; i < 1500; ++i) {
+    source.insert({i * 17 % 1501, i * 0.25});
+    mapBase.insert({i * 17 % 1501, i * 0.25});
+  }
+  s21::save_snapshot(source, path);
+
+  s21::snapshot_map<long, double> view(path);
+  EXPECT_EQ(view.size(), mapBase.size());
+  auto iterBase = mapBase.begin();
+  for (auto iterView = view.begin(); iterView != view.end();
+       ++iterView, ++iterBase) {
+    EXPECT_EQ(iterView->key, iterBase->first);
+    EXPECT_EQ(iterView->mapped, iterBase->second);
+  }
+  EXPECT_EQ(view.at(17), 0.25);
+  EXPECT_EQ(view.find(34)->mapped, 0.5);
+  EXPECT_THROW(view.at(1501), std::out_of_range);
+  EXPECT_THROW((s21::snapshot_map<long, float>(path)), std::runtime_error);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,69 @@
+#include <cstdio>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "../s21_containers_test.h"
+
+TEST(snapshotSet, lookups) {
+  std::string path = ::testing::TempDir() + "s21_snapshot_set.snap";
+  s21::set<int> source;
+  std::set<int> setBase;
+  for (int i = 0; i < 2000; ++i) {
+    source.insert(i * 13 % 4001);
+    setBase.insert(i * 13 % 4001);
+  }
+  s21::save_snapshot(source, path);
+
+  s21::snapshot_set<int> view(path);
+  EXPECT_EQ(view.size(), setBase.size());
+  EXPECT_FALSE(view.empty());
+  auto iterBase = setBase.begin();
+  for (auto iterView = view.begin(); iterView != view.end(); ++iterView)
+    EXPECT_EQ(iterView->key, *iterBase++);
+  for (int key = -1; key < 4002; key += 5) {
+    EXPECT_EQ(view.contains(key), setBase.count(key) == 1);
+    EXPECT_EQ(view.count(key), setBase.count(key));
+    auto lower = view.lower_bound(key);
+    auto lowerBase = setBase.lower_bound(key);
+    if (lowerBase == setBase.end())
+      EXPECT_TRUE(lower == view.end());
+    else
+      EXPECT_EQ(lower->key, *lowerBase);
+  }
+  EXPECT_TRUE(view.find(4001) == view.end());
+  std::remove(path.c_str());
+}
+
+TEST(snapshotSet, duplicatesAndMove) {
+  std::string path = ::testing::TempDir() + "s21_snapshot_multiset.snap";
+  s21::multiset<int> source{4, 1, 4, 2, 4};
+  s21::save_snapshot(source, path);
+
+  s21::snapshot_set<int> view(path);
+  EXPECT_EQ(view.size(), 5u);
+  EXPECT_EQ(view.count(4), 3u);
+  auto range = view.equal_range(4);
+  EXPECT_EQ(range.second - range.first, 3);
+  EXPECT_TRUE(range.second == view.end());
+
+  s21::snapshot_set<int> moved(std::move(view));
+  EXPECT_EQ(moved.size(), 5u);
+  EXPECT_TRUE(view.empty());
+  EXPECT_EQ(moved.begin()->key, 1);
+  std::remove(path.c_str());
+}
+
+TEST(snapshotSet, rejectsForeignFiles) {
+  std::string path = ::testing::TempDir() + "s21_snapshot_reject.snap";
+  s21::set<short> source{1, 2};
+  s21::save_snapshot(source, path);
+
+  EXPECT_THROW(s21::snapshot_set<int> view(path), std::runtime_error);
+  FILE *file = std::fopen(path.c_str(), "wb");
+  std::fputs("1\n2\n", file);
+  std::fclose(file);
+  EXPECT_THROW(s21::snapshot_set<short> view(path), std::runtime_error);
+  std::remove(path.c_str());
+  EXPECT_THROW(s21::snapshot_set<short> view(path), std::system_error);
+}
@@ -225,4 +225,18 @@ TEST(stack, insertManyFront) {
   }
 }
 
-}  // namespace
\ No newline at end of file
+}  // namespace
+TEST(stack, polymorphicAllocator) {
+  CountingResource resource;
+  {
+    using Alloc = std::pmr::polymorphic_allocator<int>;
+    s21::stack<int, Alloc> stack({1, 2}, Alloc(&resource));
+    stack.push(3);
+
+    EXPECT_EQ(stack.top(), 3);
+    stack.pop();
+    EXPECT_EQ(stack.top(), 2);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
@@ -0,0 +1,90 @@
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers_test.h"
+
+namespace {
+template <typename StaticSet>
+void expectSameAs(const StaticSet &setMy, const std::multiset<int> &setBase) {
+  ASSERT_EQ(setMy.size(), setBase.size());
+  auto iterBase = setBase.begin();
+  for (auto iterMy = setMy.begin(); iterMy != setMy.end(); ++iterMy)
+    EXPECT_EQ(*iterMy, *iterBase++);
+  auto reverseBase = setBase.rbegin();
+  for (auto iterMy = setMy.end(); iterMy != setMy.begin();)
+    EXPECT_EQ(*--iterMy, *reverseBase++);
+
+  for (int key = -1; key <= 130; ++key) {
+    EXPECT_EQ(setMy.contains(key), setBase.count(key) != 0);
+    EXPECT_EQ(setMy.count(key), setBase.count(key));
+    EXPECT_EQ(setMy.find(key) != setMy.end(), setBase.count(key) != 0);
+    auto lower = setMy.lower_bound(key);
+    auto lowerBase = setBase.lower_bound(key);
+    EXPECT_EQ(lower == setMy.end(), lowerBase == setBase.end());
+    if (lowerBase != setBase.end()) {
+      EXPECT_EQ(*lower, *lowerBase);
+    }
+    auto upper = setMy.upper_bound(key);
+    auto upperBase = setBase.upper_bound(key);
+    EXPECT_EQ(upper == setMy.end(), upperBase == setBase.end());
+    if (upperBase != setBase.end()) {
+      EXPECT_EQ(*upper, *upperBase);
+    }
+  }
+}
+}  // namespace
+
+TEST(staticSet, fromSetEveryShape) {
+  for (int size = 0; size <= 70; ++size) {
+    s21::set<int> source;
+    std::multiset<int> setBase;
+    for (int i = 0; i < size; ++i) {
+      source.insert(i * 37 % 71 + 30);
+      setBase.insert(i * 37 % 71 + 30);
+    }
+
+    expectSameAs(s21::static_set<int>(source), setBase);
+    expectSameAs(s21::static_set<int, s21::VanEmdeBoasLayout>(source),
+                 setBase);
+  }
+}
+
+TEST(staticSet, fromMultisetAndRange) {
+  s21::multiset<int> source;
+  std::multiset<int> setBase;
+  for (int i = 0; i < 500; ++i) {
+    source.insert(i * i % 101);
+    setBase.insert(i * i % 101);
+  }
+  std::vector<int> sorted(setBase.begin(), setBase.end());
+
+  expectSameAs(s21::static_set<int>(source), setBase);
+  expectSameAs(s21::static_set<int, s21::VanEmdeBoasLayout>(source), setBase);
+  expectSameAs(s21::static_set<int>(sorted.begin(), sorted.end()), setBase);
+  expectSameAs(s21::static_set<int, s21::VanEmdeBoasLayout>(sorted.begin(),
+                                                            sorted.end()),
+               setBase);
+}
+
+TEST(staticSet, copyAndMove) {
+  s21::set<std::string> source{"pear", "apple", "fig", "plum", "kiwi"};
+  using FrozenSet = s21::static_set<std::string, s21::VanEmdeBoasLayout>;
+  FrozenSet frozen(source);
+  source.clear();
+
+  FrozenSet copy(frozen);
+  FrozenSet moved(std::move(frozen));
+  EXPECT_TRUE(frozen.empty());
+  EXPECT_TRUE(frozen.begin() == frozen.end());
+  EXPECT_EQ(copy.size(), 5u);
+  EXPECT_EQ(*copy.begin(), "apple");
+  EXPECT_TRUE(moved.contains("kiwi"));
+  EXPECT_FALSE(moved.contains("grape"));
+  EXPECT_EQ(*moved.lower_bound("grape"), "kiwi");
+
+  frozen = std::move(copy);
+  EXPECT_EQ(frozen.size(), 5u);
+  EXPECT_EQ(*--frozen.end(), "plum");
+}
@@ -0,0 +1,62 @@
+#include <map>
+#include <string>
+
+#include "../s21_containers_test.h"
+
+TEST(unorderedMap, constructorInitializer) {
+  s21::unordered_map<int, std::string> mapMy{
+      {3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at(1), "a");
+  EXPECT_EQ(mapMy.at(3), "c");
+  EXPECT_THROW(mapMy.at(4), std::out_of_range);
+}
+
+TEST(unorderedMap, subscriptAndAssign) {
+  s21::unordered_map<std::string, int> mapMy;
+  mapMy["b"] = 2;
+  mapMy["a"] = 1;
+  ++mapMy["b"];
+  EXPECT_FALSE(mapMy.insert_or_assign("a", 5).second);
+  EXPECT_TRUE(mapMy.insert_or_assign("c", 7).second);
+  EXPECT_FALSE(mapMy.insert("c", 8).second);
+
+  EXPECT_EQ(mapMy.size(), 3u);
+  EXPECT_EQ(mapMy.at("a"), 5);
+  EXPECT_EQ(mapMy.at("b"), 3);
+  EXPECT_EQ(mapMy.at("c"), 7);
+}
+
+TEST(unorderedMap, matchesStdMap) {
+  s21::unordered_map<int, int> mapMy;
+  std::map<int, int> mapBase;
+  for (int i = 0; i < 20000; ++i) {
+    int key = i * 7919 % 4099;
+    mapMy[key] += i;
+    mapBase[key] += i;
+    if (i % 7 == 0) {
+      auto iter = mapMy.find(i % 4099);
+      if (iter != mapMy.end()) mapMy.erase(iter);
+      mapBase.erase(i % 4099);
+    }
+  }
+
+  EXPECT_EQ(mapMy.size(), mapBase.size());
+  std::map<int, int> collected;
+  for (auto iter = mapMy.begin(); iter != mapMy.end(); ++iter)
+    collected[iter.key()] = *iter;
+  EXPECT_TRUE(collected == mapBase);
+}
+
+TEST(unorderedMap, insertMany) {
+  s21::unordered_map<int, char> mapMy;
+  auto result = mapMy.insert_many(std::pair<const int, char>(1, 'a'),
+                                  std::pair<const int, char>(2, 'b'),
+                                  std::pair<const int, char>(1, 'c'));
+
+  EXPECT_EQ(mapMy.size(), 2u);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[2].second);
+  EXPECT_EQ(*result[2].first, 'a');
+}
@@ -0,0 +1,141 @@
+#include <set>
+#include <string>
+#include <unordered_set>
+
+#include "../s21_containers_test.h"
+
+namespace {
+struct ConstantHash {
+  size_t operator()(int) const { return 42; }
+};
+}  // namespace
+
+TEST(unorderedSet, constructorInitializer) {
+  s21::unordered_set<std::string> setMy{"b", "a", "c", "a"};
+
+  EXPECT_EQ(setMy.size(), 3u);
+  EXPECT_TRUE(setMy.contains("a"));
+  EXPECT_TRUE(setMy.contains("c"));
+  EXPECT_FALSE(setMy.contains("d"));
+}
+
+TEST(unorderedSet, emptyBeginIsEnd) {
+  s21::unordered_set<int> setMy;
+
+  EXPECT_TRUE(setMy.empty());
+  EXPECT_TRUE(setMy.begin() == setMy.end());
+  EXPECT_TRUE(setMy.find(1) == setMy.end());
+  EXPECT_EQ(setMy.bucket_count(), 0u);
+}
+
+TEST(unorderedSet, insertFindErase) {
+  s21::unordered_set<int> setMy;
+  std::unordered_set<int> setBase;
+  for (int i = 0; i < 10000; ++i) {
+    int key = i * 7919 % 10007;
+    EXPECT_EQ(setMy.insert(key).second, setBase.insert(key).second);
+  }
+  EXPECT_FALSE(setMy.insert(7919).second);
+  EXPECT_LE(setMy.load_factor(), 0.875f);
+
+  for (int key = 0; key < 10007; key += 3) {
+    auto iter = setMy.find(key);
+    if (setBase.erase(key)) {
+      ASSERT_TRUE(iter != setMy.end());
+      setMy.erase(iter);
+    }
+  }
+
+  EXPECT_EQ(setMy.size(), setBase.size());
+  std::set<int> seen;
+  for (auto iter = setMy.begin(); iter != setMy.end(); ++iter)
+    EXPECT_TRUE(seen.insert(*iter).second);
+  EXPECT_EQ(seen.size(), setBase.size());
+  for (int key : setBase) EXPECT_TRUE(setMy.contains(key));
+}
+
+TEST(unorderedSet, eraseAndReinsertChurn) {
+  s21::unordered_set<int> setMy;
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 100; ++i) setMy.insert(round * 100 + i);
+    for (int i = 0; i < 100; ++i) setMy.erase(setMy.find(round * 100 + i));
+  }
+
+  EXPECT_TRUE(setMy.empty());
+  EXPECT_LE(setMy.bucket_count(), 256u);
+}
+
+TEST(unorderedSet, collidingHashes) {
+  s21::unordered_set<int, ConstantHash> setMy;
+  for (int i = 0; i < 100; ++i) setMy.insert(i);
+  setMy.erase(setMy.find(50));
+
+  EXPECT_EQ(setMy.size(), 99u);
+  EXPECT_FALSE(setMy.contains(50));
+  for (int i = 0; i < 100; ++i) {
+    if (i != 50) {
+      EXPECT_TRUE(setMy.contains(i));
+    }
+  }
+}
+
+TEST(unorderedSet, mergeLeavesDuplicates) {
+  s21::unordered_set<int> setMy{1, 3, 5};
+  s21::unordered_set<int> other{2, 3, 4, 5};
+  setMy.merge(other);
+
+  EXPECT_EQ(setMy.size(), 5u);
+  EXPECT_EQ(other.size(), 2u);
+  EXPECT_TRUE(other.contains(3));
+  EXPECT_TRUE(other.contains(5));
+}
+
+TEST(unorderedSet, copyAndMove) {
+  s21::unordered_set<std::string> setMy{"a", "b", "c"};
+  s21::unordered_set<std::string> setCopy(setMy);
+  s21::unordered_set<std::string> setMoved(std::move(setMy));
+
+  EXPECT_EQ(setCopy.size(), 3u);
+  EXPECT_EQ(setMoved.size(), 3u);
+  EXPECT_TRUE(setMy.empty());
+  EXPECT_TRUE(setCopy.contains("b"));
+  setMy = std::move(setCopy);
+  EXPECT_TRUE(setMy.contains("c"));
+}
+
+TEST(unorderedSet, pmrAllocator) {
+  CountingResource resource;
+  {
+    s21::unordered_set<int, std::hash<int>, std::equal_to<int>,
+                       std::pmr::polymorphic_allocator<int>>
+        setMy(&resource);
+    for (int i = 0; i < 100; ++i) setMy.insert(i);
+    EXPECT_EQ(setMy.size(), 100u);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
+
+TEST(unorderedSet, moveAssignPropagatingAllocator) {
+  using Set = s21::unordered_set<int, std::hash<int>, std::equal_to<int>,
+                                 MovingAllocator<int>>;
+  CountingResource resource, other;
+  {
+    MovingAllocator<int> alloc(&resource), otherAlloc(&other);
+    Set target(otherAlloc);
+    Set source(alloc);
+    target.insert(-1);
+    for (int i = 0; i < 500; ++i) source.insert(i);
+    size_t allocations = resource.allocations;
+
+    target = std::move(source);
+
+    EXPECT_EQ(resource.allocations, allocations);
+    EXPECT_EQ(target.size(), 500u);
+    EXPECT_TRUE(target.contains(499));
+    EXPECT_FALSE(target.contains(-1));
+    EXPECT_TRUE(source.empty());
+  }
+  EXPECT_EQ(other.allocations, other.deallocations);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
@@ -384,3 +384,57 @@ TEST(vector, insertManyBack) {
     ++it1, ++it2;
   }
 }
+
+TEST(vector, polymorphicAllocator) {
+  CountingResource resource;
+  {
+    std::pmr::polymorphic_allocator<int> alloc(&resource);
+    s21::vector<int, std::pmr::polymorphic_allocator<int>> v(alloc);
+    for (int i = 0; i < 100; ++i) v.push_back(i);
+    v.insert(v.begin(), -1);
+    v.erase(v.begin() + 50);
+    v.shrink_to_fit();
+
+    EXPECT_EQ(v.size(), 100);
+    EXPECT_EQ(v[0], -1);
+    EXPECT_EQ(v[99], 99);
+    EXPECT_TRUE(v.get_allocator() == alloc);
+  }
+  EXPECT_GT(resource.allocations, 0u);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
+
+TEST(vector, nonTrivialElements) {
+  s21::vector<std::string> v{"a", "b"};
+  v.push_back(v[0]);
+  v.insert(v.begin() + 1, "c");
+  v.erase(v.begin());
+  v.pop_back();
+  s21::vector<std::string> copy(v);
+
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy[0], "c");
+  EXPECT_EQ(copy[1], "b");
+}
+
+TEST(vector, moveAssignPropagatingAllocator) {
+  CountingResource resource, other;
+  {
+    MovingAllocator<int> alloc(&resource), otherAlloc(&other);
+    s21::vector<int, MovingAllocator<int>> target(otherAlloc);
+    s21::vector<int, MovingAllocator<int>> source(alloc);
+    target.push_back(-1);
+    for (int i = 0; i < 100; ++i) source.push_back(i);
+    int *buffer = source.data();
+
+    target = std::move(source);
+
+    EXPECT_TRUE(target.get_allocator() == alloc);
+    EXPECT_EQ(target.data(), buffer);
+    EXPECT_EQ(target.size(), 100);
+    EXPECT_EQ(target[99], 99);
+    EXPECT_TRUE(source.empty());
+  }
+  EXPECT_EQ(other.allocations, other.deallocations);
+  EXPECT_EQ(resource.allocations, resource.deallocations);
+}
@@ -3,7 +3,72 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <type_traits>
+
 #include "s21_containers.h"
 #include "s21_containersplus.h"
 
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+  size_t deallocations = 0;
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// Stateful allocator that propagates on move assignment and, like one
+// holding a shared_ptr, is left without a resource when moved from.
+template <typename T>
+class MovingAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::false_type;
+
+  CountingResource *resource;
+
+  explicit MovingAllocator(CountingResource *resource) : resource(resource) {}
+  template <typename U>
+  MovingAllocator(const MovingAllocator<U> &other)
+      : resource(other.resource) {}
+  MovingAllocator(const MovingAllocator &other) = default;
+  MovingAllocator(MovingAllocator &&other) : resource(other.resource) {
+    other.resource = nullptr;
+  }
+  MovingAllocator &operator=(const MovingAllocator &other) = default;
+  MovingAllocator &operator=(MovingAllocator &&other) {
+    resource = other.resource;
+    other.resource = nullptr;
+    return *this;
+  }
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(resource->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *ptr, size_t n) {
+    resource->deallocate(ptr, n * sizeof(T), alignof(T));
+  }
+
+  template <typename U>
+  bool operator==(const MovingAllocator<U> &other) const {
+    return resource == other.resource;
+  }
+  template <typename U>
+  bool operator!=(const MovingAllocator<U> &other) const {
+    return resource != other.resource;
+  }
+};
+
 #endif
@@ -2,6 +2,26 @@
 #define __S21_CONTAINERSPLUS_H__
 
 #include "containers/s21_array.h"
+#include "containers/s21_btree_map.h"
+#include "containers/s21_btree_multiset.h"
+#include "containers/s21_btree_set.h"
+#include "containers/s21_concurrent_map.h"
+#include "containers/s21_concurrent_set.h"
+#include "containers/s21_concurrent_unordered_map.h"
+#include "containers/s21_flat_map.h"
+#include "containers/s21_flat_multiset.h"
+#include "containers/s21_flat_set.h"
+#include "containers/s21_index_map.h"
+#include "containers/s21_index_multiset.h"
+#include "containers/s21_index_set.h"
 #include "containers/s21_multiset.h"
+#include "containers/s21_node_pool.h"
+#include "containers/s21_persistent_map.h"
+#include "containers/s21_persistent_set.h"
+#include "containers/s21_snapshot_map.h"
+#include "containers/s21_snapshot_set.h"
+#include "containers/s21_static_set.h"
+#include "containers/s21_unordered_map.h"
+#include "containers/s21_unordered_set.h"
 
 #endif
\ No newline at end of file